@@ -0,0 +1,182 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <GL/gl.h>
+
+#include "../src/graphics/color/rgba.hpp"
+#include "../src/graphics/rendering/batch_renderer.hpp"
+#include "../src/graphics/rendering/gl_render_backend.hpp"
+#include "../src/graphics/shapes/circle.hpp"
+#include "../src/graphics/shapes/model_2d.hpp"
+#include "../src/graphics/shapes/rectangle.hpp"
+#include "../src/math/vector.hpp"
+#include "offscreen_context.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::GLRenderBackend;
+using ::graphics::shapes::Circle;
+using ::graphics::shapes::Model2D;
+using ::graphics::shapes::Rectangle;
+using ::math::Matrix;
+using ::math::Vector;
+using ::std::cout;
+using ::std::endl;
+using ::std::vector;
+
+static const int kWidth = 500;
+static const int kHeight = 500;
+
+// Roughly what one character submits: a head, a torso, two arms and two legs of two
+// parts each, and a four part gun.
+void AddCharacter(vector<Model2D *> &scene, double x, double y)
+{
+    RGBA color(0, 200, 0);
+    RGBA gun_color(60, 60, 60);
+
+    Vector head(2);
+    head[0] = x;
+    head[1] = y;
+    scene.push_back(new Circle(head, 2, color));
+
+    for (int i = 0; i < 9; i++)
+    {
+        Vector origin(2);
+        origin[0] = x - 1 + (i % 3);
+        origin[1] = y + 2 + i;
+        scene.push_back(new Rectangle(origin, 1, 3, color));
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        Vector origin(2);
+        origin[0] = x + 1 + i;
+        origin[1] = y + 5;
+        scene.push_back(new Rectangle(origin, 1.5, 0.5, gun_color));
+    }
+}
+
+void BuildScene(vector<Model2D *> &scene, int characters, int bullets)
+{
+    RGBA background_color(0, 0, 255);
+    RGBA obstacle_color(0, 0, 0);
+    RGBA bullet_color(255, 0, 0);
+
+    scene.push_back(new Rectangle(Vector::Zero(2), 500, 500, background_color));
+
+    for (int i = 0; i < 50; i++)
+    {
+        Vector origin(2);
+        origin[0] = (i * 37) % 480;
+        origin[1] = (i * 53) % 480;
+        scene.push_back(new Rectangle(origin, 20, 5, obstacle_color));
+    }
+
+    for (int i = 0; i < characters; i++)
+        AddCharacter(scene, (i * 13) % 480 + 10, (i * 29) % 470 + 10);
+
+    for (int i = 0; i < bullets; i++)
+    {
+        Vector origin(2);
+        origin[0] = (i * 7) % 500;
+        origin[1] = (i * 11) % 500;
+        scene.push_back(new Circle(origin, 0.5, bullet_color));
+    }
+}
+
+// The per-shape glBegin/glEnd path the game used before batching.
+void DrawImmediate(const Model2D &shape)
+{
+    Matrix points = shape.get_points();
+    const RGBA &color = shape.get_color();
+
+    glColor4f(color.get_normalized_red(), color.get_normalized_green(), color.get_normalized_blue(), color.get_normalized_alpha());
+    glBegin(GL_POLYGON);
+    for (int i = 0; i < points.get_rows(); i++)
+        glVertex2d(points[i][0], points[i][1]);
+    glEnd();
+}
+
+double TimeImmediate(vector<Model2D *> &scene, int frames)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        for (auto &shape : scene)
+            DrawImmediate(*shape);
+        glFinish();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / frames;
+}
+
+double TimeBatched(vector<Model2D *> &scene, BatchRenderer &renderer, int frames)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        renderer.Begin();
+        for (auto &shape : scene)
+            shape->Draw(renderer);
+        renderer.End();
+        glFinish();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / frames;
+}
+
+void RunBenchmark(int characters, int bullets)
+{
+    vector<Model2D *> scene;
+    BuildScene(scene, characters, bullets);
+
+    GLRenderBackend backend;
+    BatchRenderer renderer;
+    renderer.set_backend(&backend);
+    int frames = 50;
+
+    TimeImmediate(scene, 2);
+    double immediate_ms = TimeImmediate(scene, frames);
+
+    TimeBatched(scene, renderer, 2);
+    double batched_ms = TimeBatched(scene, renderer, frames);
+
+    cout << characters << " characters, " << bullets << " bullets (" << scene.size() << " shapes): "
+         << "immediate " << immediate_ms << " ms/frame (" << scene.size() << " draw calls), "
+         << "batched " << batched_ms << " ms/frame (" << renderer.get_draw_calls() << " draw calls, "
+         << renderer.get_vertex_count() << " vertices), "
+         << immediate_ms / batched_ms << "x" << endl;
+
+    for (auto &shape : scene)
+        delete shape;
+}
+
+int main()
+{
+    if (!CreateOffscreenContext(kWidth, kHeight))
+    {
+        cout << "Could not create an offscreen OpenGL context, skipping" << endl;
+        return 0;
+    }
+
+    cout << "Renderer: " << glGetString(GL_RENDERER) << endl;
+
+    glViewport(0, 0, kWidth, kHeight);
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(0, 500, 500, 0, -1, 1);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    RunBenchmark(10, 100);
+    RunBenchmark(100, 1000);
+    RunBenchmark(1000, 10000);
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include "../src/graphics/elements/bullet_system.hpp"
+
+using ::graphics::elements::BulletSystem;
+using ::std::cout;
+using ::std::endl;
+
+double RunBenchmark(int bullets)
+{
+    BulletSystem bullet_system(bullets);
+    for (int i = 0; i < bullets; i++)
+    {
+        double angle = 2 * M_PI * i / bullets;
+        bullet_system.Spawn(0, 0, 0.05 * std::cos(angle), 0.05 * std::sin(angle), 0.5, nullptr);
+    }
+
+    // Stay at roughly the same amount of total work for every size.
+    int ticks = std::max(10, 200000000 / bullets);
+    double delta_time = 1;
+
+    bullet_system.Update(delta_time);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ticks; i++)
+        bullet_system.Update(delta_time);
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double checksum = bullet_system.get_x(bullets - 1) + bullet_system.get_y(bullets / 2);
+
+    double tick_ms = seconds * 1000 / ticks;
+    double bullets_per_second = static_cast<double>(bullets) * ticks / seconds;
+
+    cout << bullets << " bullets: " << tick_ms << " ms/tick, "
+         << bullets_per_second / 1e6 << " M bullet updates/s, "
+         << 1e9 / bullets_per_second << " ns/bullet"
+         << " (checksum " << checksum << ")" << endl;
+
+    return bullets_per_second;
+}
+
+int main()
+{
+    RunBenchmark(10000);
+    RunBenchmark(100000);
+    RunBenchmark(1000000);
+
+    return 0;
+}
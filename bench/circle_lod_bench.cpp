@@ -0,0 +1,140 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <GL/gl.h>
+
+#include "../src/graphics/color/rgba.hpp"
+#include "../src/graphics/elements/bullet_system.hpp"
+#include "../src/graphics/elements/character/character.hpp"
+#include "../src/graphics/rendering/batch_renderer.hpp"
+#include "../src/graphics/rendering/gl_render_backend.hpp"
+#include "../src/graphics/rendering/irender_backend.hpp"
+#include "../src/graphics/rendering/recording_render_backend.hpp"
+#include "../src/math/vector.hpp"
+#include "offscreen_context.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::elements::BulletSystem;
+using ::graphics::elements::character::Character;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::GLRenderBackend;
+using ::graphics::rendering::IRenderBackend;
+using ::graphics::rendering::RecordingRenderBackend;
+using ::math::Vector;
+using ::std::cout;
+using ::std::endl;
+using ::std::vector;
+
+static const int kWidth = 500;
+static const int kHeight = 500;
+static const double kViewSize = 500;
+
+struct Scene
+{
+    BulletSystem bullets;
+    vector<Character *> characters;
+
+    Scene(int bullet_count)
+        : bullets(bullet_count)
+    {
+        RGBA character_color(255, 0, 0);
+        for (int i = 0; i < bullet_count; i++)
+            bullets.Spawn((i * 7919) % static_cast<int>(kViewSize), (i * 104729) % static_cast<int>(kViewSize), 0, 0, 0.5, nullptr);
+
+        for (int i = 0; i < 20; i++)
+        {
+            Vector origin(2);
+            origin[0] = i * 24 + 10;
+            origin[1] = 250;
+            characters.push_back(new Character(origin, 8, character_color, false));
+        }
+    }
+
+    ~Scene()
+    {
+        for (auto &character : characters)
+            delete character;
+    }
+};
+
+double TimeFrames(IRenderBackend &backend, Scene &scene, BatchRenderer &renderer, int frames, bool finish)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        backend.Clear();
+
+        renderer.Begin();
+        for (auto &character : scene.characters)
+            character->Render(renderer);
+        scene.bullets.Render(renderer);
+        renderer.End();
+
+        if (finish)
+            glFinish();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / frames;
+}
+
+// A zero tolerance can never be met, so every circle falls back to the finest level,
+// which is the fixed 32 segments circles used to get.
+void RunBenchmark(const char *name, IRenderBackend &backend, int bullet_count, double pixels_per_unit, int frames, bool finish)
+{
+    Scene scene(bullet_count);
+    double tolerance = BatchRenderer::circle_tolerance_;
+
+    BatchRenderer::circle_tolerance_ = 0;
+    BatchRenderer fixed_renderer;
+    fixed_renderer.set_backend(&backend);
+    fixed_renderer.set_pixels_per_unit(pixels_per_unit);
+
+    BatchRenderer::circle_tolerance_ = tolerance;
+    BatchRenderer lod_renderer;
+    lod_renderer.set_backend(&backend);
+    lod_renderer.set_pixels_per_unit(pixels_per_unit);
+
+    TimeFrames(backend, scene, fixed_renderer, 2, finish);
+    double fixed_ms = TimeFrames(backend, scene, fixed_renderer, frames, finish);
+    TimeFrames(backend, scene, lod_renderer, 2, finish);
+    double lod_ms = TimeFrames(backend, scene, lod_renderer, frames, finish);
+
+    int fixed_vertices = fixed_renderer.get_vertex_count();
+    int lod_vertices = lod_renderer.get_vertex_count();
+
+    cout << name << ", " << bullet_count << " bullets at " << pixels_per_unit << " px/unit: "
+         << "fixed " << fixed_vertices << " vertices " << fixed_ms << " ms/frame, "
+         << "lod " << lod_vertices << " vertices " << lod_ms << " ms/frame "
+         << "(bullets " << lod_renderer.get_circle_segments(0.5) << " segments, heads " << lod_renderer.get_circle_segments(2.4) << "), "
+         << static_cast<double>(fixed_vertices) / lod_vertices << "x fewer vertices, "
+         << fixed_ms / lod_ms << "x faster" << endl;
+}
+
+int main()
+{
+    RecordingRenderBackend recording_backend(false);
+    RunBenchmark("recording", recording_backend, 10000, 1, 200, false);
+    RunBenchmark("recording", recording_backend, 10000, 8, 200, false);
+    RunBenchmark("recording", recording_backend, 100000, 1, 20, false);
+
+    if (!CreateOffscreenContext(kWidth, kHeight))
+    {
+        cout << "Could not create an offscreen OpenGL context, skipping the GL run" << endl;
+        return 0;
+    }
+
+    glViewport(0, 0, kWidth, kHeight);
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(0, kViewSize, kViewSize, 0, -1, 1);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    GLRenderBackend gl_backend;
+    RunBenchmark(reinterpret_cast<const char *>(glGetString(GL_RENDERER)), gl_backend, 10000, 1, 50, true);
+    RunBenchmark(reinterpret_cast<const char *>(glGetString(GL_RENDERER)), gl_backend, 100000, 1, 10, true);
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../src/graphics/color/rgba.hpp"
+#include "../src/graphics/elements/bullet_system.hpp"
+#include "../src/graphics/elements/character/character.hpp"
+#include "../src/graphics/elements/map.hpp"
+#include "../src/graphics/elements/obstacle.hpp"
+#include "../src/graphics/rendering/batch_renderer.hpp"
+#include "../src/graphics/rendering/recording_render_backend.hpp"
+#include "../src/graphics/shapes/rectangle.hpp"
+#include "../src/math/vector.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::elements::BulletSystem;
+using ::graphics::elements::Map;
+using ::graphics::elements::Obstacle;
+using ::graphics::elements::character::Character;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::RecordingRenderBackend;
+using ::graphics::shapes::Rectangle;
+using ::math::Vector;
+using ::std::cout;
+using ::std::endl;
+using ::std::vector;
+
+// Builds frames the way Game::Display does, against a backend that never touches a GPU.
+void RunBenchmark(int obstacles, int characters, int bullets, bool capture_geometry)
+{
+    RGBA background_color(0, 0, 255);
+    RGBA obstacle_color(0, 0, 0);
+    RGBA character_color(255, 0, 0);
+
+    Map map;
+    map.set_background(new Rectangle(Vector::Zero(2), 1000, 500, background_color));
+    for (int i = 0; i < obstacles; i++)
+    {
+        Vector origin(2);
+        origin[0] = (i * 37) % 980;
+        origin[1] = (i * 53) % 480;
+        map.AddObstacle(new Obstacle(origin, 20, 5, obstacle_color));
+    }
+
+    vector<Character *> scene_characters;
+    for (int i = 0; i < characters; i++)
+    {
+        Vector origin(2);
+        origin[0] = (i * 13) % 980 + 10;
+        origin[1] = (i * 29) % 470 + 10;
+        scene_characters.push_back(new Character(origin, 4, character_color, false));
+    }
+
+    BulletSystem bullet_system(bullets);
+    for (int i = 0; i < bullets; i++)
+    {
+        double angle = 2 * M_PI * i / bullets;
+        bullet_system.Spawn((i * 7) % 1000, (i * 11) % 500, 0.05 * std::cos(angle), 0.05 * std::sin(angle), 0.5, nullptr);
+    }
+
+    RecordingRenderBackend backend(capture_geometry);
+    BatchRenderer renderer;
+    renderer.set_backend(&backend);
+
+    int frames = 200;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        backend.Reset();
+        backend.Clear();
+
+        renderer.Begin();
+        map.Render(renderer);
+        for (auto &character : scene_characters)
+            character->Render(renderer);
+        bullet_system.Render(renderer);
+        renderer.End();
+
+        backend.Present();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double frame_ms = std::chrono::duration<double, std::milli>(end - start).count() / frames;
+
+    cout << obstacles << " obstacles, " << characters << " characters, " << bullets << " bullets"
+         << (capture_geometry ? " (captured): " : ": ")
+         << frame_ms << " ms/frame, "
+         << backend.get_draw_count() << " draws, "
+         << backend.get_vertex_count() << " vertices, "
+         << backend.get_triangle_count() << " triangles, "
+         << backend.get_commands().size() << " commands" << endl;
+
+    for (auto &character : scene_characters)
+        delete character;
+}
+
+int main()
+{
+    RunBenchmark(50, 10, 100, false);
+    RunBenchmark(50, 10, 100, true);
+    RunBenchmark(500, 100, 1000, false);
+    RunBenchmark(500, 100, 1000, true);
+    RunBenchmark(5000, 1000, 10000, false);
+    RunBenchmark(5000, 1000, 10000, true);
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include "../src/game/frame_scheduler.hpp"
+
+using ::shoot_and_jump::FrameScheduler;
+using ::std::cout;
+using ::std::endl;
+
+static const double kRunTime = 1500;
+static volatile double sink;
+
+// Stands in for replaying a snapshot: a fixed amount of CPU work per frame.
+void RenderFrame()
+{
+    double value = 0;
+    for (int i = 0; i < 200000; i++)
+        value += std::sqrt(i);
+    sink = value;
+}
+
+double Elapsed(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void Report(const char *mode, const FrameScheduler &scheduler)
+{
+    cout << mode << ": " << scheduler.get_frame_rate() << " fps, "
+         << scheduler.get_frame_time() << " ms/frame, jitter " << scheduler.get_jitter() << " ms, "
+         << "cpu " << scheduler.get_cpu_utilization() << "%" << endl;
+}
+
+// The loop the game used to run: poll the clock and draw whenever 0.1 ms went by.
+void RunPolling()
+{
+    FrameScheduler scheduler;
+    auto start = std::chrono::steady_clock::now();
+    double last_frame = 0;
+
+    while (Elapsed(start) < kRunTime)
+    {
+        double now = Elapsed(start);
+        if (now - last_frame > 0.1)
+        {
+            last_frame = now;
+            RenderFrame();
+            scheduler.MarkFrame();
+        }
+    }
+
+    Report("polling", scheduler);
+}
+
+void RunPaced(const char *mode, double target_fps, bool focused)
+{
+    FrameScheduler scheduler(target_fps);
+    scheduler.set_focused(focused);
+    auto start = std::chrono::steady_clock::now();
+
+    while (Elapsed(start) < kRunTime)
+    {
+        scheduler.WaitForNextFrame();
+        RenderFrame();
+        scheduler.MarkFrame();
+    }
+
+    Report(mode, scheduler);
+}
+
+int main()
+{
+    FrameScheduler::report_interval_ = kRunTime - 100;
+
+    RunPolling();
+    RunPaced("paced 144 fps", 144, true);
+    RunPaced("paced 60 fps", 60, true);
+    RunPaced("paced 60 fps, unfocused", 60, false);
+
+    return 0;
+}
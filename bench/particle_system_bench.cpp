@@ -0,0 +1,233 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "../src/graphics/color/palette.hpp"
+#include "../src/graphics/elements/particle_effect.hpp"
+#include "../src/graphics/elements/particle_system.hpp"
+#include "../src/graphics/rendering/batch_renderer.hpp"
+#include "../src/graphics/rendering/camera.hpp"
+#include "../src/graphics/rendering/irender_backend.hpp"
+#include "../src/graphics/rendering/static_mesh.hpp"
+#include "../src/graphics/shapes/circle.hpp"
+#include "../src/math/vector.hpp"
+
+namespace palette = ::graphics::color::palette;
+using ::graphics::color::RGBA;
+using ::graphics::elements::ParticleEffect;
+using ::graphics::elements::ParticleSystem;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::Camera;
+using ::graphics::rendering::IRenderBackend;
+using ::graphics::rendering::StaticMesh;
+using ::graphics::shapes::Circle;
+using ::math::Vector;
+using ::std::cout;
+using ::std::endl;
+using ::std::vector;
+
+static const int kParticles = 100000;
+static const int kFrames = 200;
+static const double kDeltaTime = 1000.0 / 60;
+
+static bool counting = false;
+static long allocations = 0;
+
+void *operator new(size_t size)
+{
+    if (counting)
+        allocations++;
+
+    void *pointer = std::malloc(size);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+// Swallows the batches, so only building them is measured.
+class NullRenderBackend : public IRenderBackend
+{
+public:
+    void SetClearColor(const RGBA &color) override {}
+    void SetProjection(double left, double right, double bottom, double top, double near, double far) override {}
+    void Translate(double dx, double dy) override {}
+    void Clear() override {}
+    void DrawTriangles(const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count) override {}
+    void DrawStaticMesh(const StaticMesh &mesh) override {}
+    void Present() override {}
+};
+
+// Long-lived, slow sparks so the pool stays full and every frame refills what expired.
+ParticleEffect StressEffect()
+{
+    ParticleEffect effect;
+    effect.count = 64;
+    effect.min_speed = 0.001;
+    effect.max_speed = 0.01;
+    effect.spread = 2 * M_PI;
+    effect.lifetime = 4000;
+    effect.size = 1;
+    effect.color = palette::kOrange;
+    return effect;
+}
+
+void Refill(ParticleSystem &particles, const ParticleEffect &effect, int frame)
+{
+    while (particles.get_size() < particles.get_capacity())
+        particles.Emit(effect, (frame * 37) % 500, (frame * 53) % 500, frame);
+}
+
+void RunPooled()
+{
+    ParticleSystem particles(kParticles);
+    ParticleEffect effect = StressEffect();
+    NullRenderBackend backend;
+    BatchRenderer renderer;
+    renderer.set_backend(&backend);
+    Camera camera;
+    camera.Reset(0, 0, 500, 500);
+
+    double update_time = 0;
+    double render_time = 0;
+    long emitted = 0;
+    long steady_allocations = 0;
+
+    for (int frame = 0; frame < kFrames; frame++)
+    {
+        // The first frames size the batch buffers; everything after is steady state.
+        counting = frame >= 10;
+        allocations = 0;
+
+        int before = particles.get_size();
+        Refill(particles, effect, frame);
+        emitted += particles.get_size() - before;
+
+        auto start = std::chrono::steady_clock::now();
+        particles.Update(kDeltaTime);
+        auto updated = std::chrono::steady_clock::now();
+
+        camera.BeginFrame();
+        renderer.Begin();
+        particles.Render(renderer, camera);
+        renderer.End();
+        auto rendered = std::chrono::steady_clock::now();
+
+        counting = false;
+        steady_allocations += allocations;
+
+        if (frame >= 10)
+        {
+            update_time += std::chrono::duration<double, std::milli>(updated - start).count();
+            render_time += std::chrono::duration<double, std::milli>(rendered - updated).count();
+        }
+    }
+
+    int measured = kFrames - 10;
+    cout << "pooled SoA: " << particles.get_size() << " live, update " << update_time / measured << " ms/frame ("
+         << update_time / measured * 1e6 / kParticles << " ns/particle), batch " << render_time / measured << " ms/frame, "
+         << emitted / kFrames << " respawned/frame, " << steady_allocations << " heap allocations in " << measured << " steady frames" << endl;
+}
+
+// One heap shape per particle, the way effects would be added without a pool.
+void RunNaive()
+{
+    struct Spark
+    {
+        Circle *shape;
+        double velocity_x;
+        double velocity_y;
+        double age;
+        double lifetime;
+    };
+
+    ParticleEffect effect = StressEffect();
+    RGBA color = effect.color;
+    NullRenderBackend backend;
+    BatchRenderer renderer;
+    renderer.set_backend(&backend);
+
+    vector<Spark> sparks;
+    unsigned int random_state = 2463534242u;
+    auto random = [&random_state]()
+    {
+        random_state ^= random_state << 13;
+        random_state ^= random_state >> 17;
+        random_state ^= random_state << 5;
+        return random_state / 4294967296.0;
+    };
+
+    double frame_time = 0;
+    long steady_allocations = 0;
+
+    for (int frame = 0; frame < kFrames; frame++)
+    {
+        counting = frame >= 10;
+        allocations = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        while ((int)sparks.size() < kParticles)
+        {
+            Vector origin(2);
+            origin[0] = (frame * 37) % 500;
+            origin[1] = (frame * 53) % 500;
+            double angle = random() * 2 * M_PI;
+            double speed = effect.min_speed + random() * (effect.max_speed - effect.min_speed);
+            sparks.push_back({new Circle(origin, effect.size / 2, color), speed * std::cos(angle), speed * std::sin(angle), 0, effect.lifetime * (0.5 + random() * 0.5)});
+        }
+
+        for (size_t i = 0; i < sparks.size();)
+        {
+            Spark &spark = sparks[i];
+            spark.age += kDeltaTime;
+            if (spark.age >= spark.lifetime)
+            {
+                delete spark.shape;
+                spark = sparks.back();
+                sparks.pop_back();
+                continue;
+            }
+
+            spark.velocity_y += ParticleSystem::gravity_ * kDeltaTime;
+            spark.shape->Translate(spark.velocity_x * kDeltaTime, spark.velocity_y * kDeltaTime);
+            i++;
+        }
+
+        renderer.Begin();
+        for (auto &spark : sparks)
+            spark.shape->Draw(renderer);
+        renderer.End();
+
+        counting = false;
+        steady_allocations += allocations;
+        if (frame >= 10)
+            frame_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    for (auto &spark : sparks)
+        delete spark.shape;
+
+    int measured = kFrames - 10;
+    cout << "naive shapes: " << kParticles << " live, update and batch " << frame_time / measured << " ms/frame, "
+         << steady_allocations << " heap allocations in " << measured << " steady frames" << endl;
+}
+
+int main()
+{
+    RunPooled();
+    RunNaive();
+
+    return 0;
+}
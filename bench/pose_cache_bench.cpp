@@ -0,0 +1,158 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "../src/graphics/elements/character/animation/animated_bone.hpp"
+#include "../src/graphics/elements/character/animation/animation_clip.hpp"
+#include "../src/graphics/elements/character/animation/animation_system.hpp"
+#include "../src/graphics/elements/character/animation/clip_sampler.hpp"
+#include "../src/graphics/elements/character/animation/pose_cache.hpp"
+#include "../src/graphics/elements/character/skeleton.hpp"
+
+using ::graphics::elements::character::AnimationClip;
+using ::graphics::elements::character::AnimationSystem;
+using ::graphics::elements::character::ClipSampler;
+using ::graphics::elements::character::kRigBoneCount;
+using ::graphics::elements::character::PoseCache;
+using ::graphics::elements::character::RigBone;
+using ::graphics::elements::character::Skeleton;
+using ::std::cout;
+using ::std::endl;
+using ::std::vector;
+
+static const int kWalkers = 1000;
+static const int kTicks = 2000;
+static const double kDeltaTime = 1;
+// Walker i starts i * kStagger ms into its walk, so the crowd is spread over the stride.
+static const double kStagger = 0.37;
+static const int kRounds = 3;
+
+// Same bone layout as a character.
+struct Walker
+{
+    Skeleton skeleton;
+    int bones[kRigBoneCount];
+
+    Walker(int index)
+    {
+        int head = skeleton.AddBone(-1, 0, -10);
+        int torso = skeleton.AddBone(head, 0, 5);
+        int left_arm = skeleton.AddBone(torso, 0, 2);
+        skeleton.AddBone(torso, 0, 2);
+        int left_thig = skeleton.AddBone(torso, 0, 10);
+        int right_thig = skeleton.AddBone(torso, 0, 10);
+        int left_calf = skeleton.AddBone(left_thig, 0, 5);
+        int right_calf = skeleton.AddBone(right_thig, 0, 5);
+        skeleton.AddBone(left_arm, 0, 0);
+
+        bones[static_cast<int>(RigBone::kHead)] = head;
+        bones[static_cast<int>(RigBone::kTorso)] = torso;
+        bones[static_cast<int>(RigBone::kLeftThig)] = left_thig;
+        bones[static_cast<int>(RigBone::kLeftCalf)] = left_calf;
+        bones[static_cast<int>(RigBone::kRightThig)] = right_thig;
+        bones[static_cast<int>(RigBone::kRightCalf)] = right_calf;
+
+        skeleton.set_position(index * 3, 0);
+        if (index % 2)
+            skeleton.Mirror();
+    }
+};
+
+// Samples the walk every tick with the ClipSampler the cache is baked with, which is
+// what playing the clip without a cache costs.
+class SampledWalk
+{
+public:
+    SampledWalk(Walker &walker, bool mirrored)
+        : walker_(&walker), sampler_(AnimationClip::Walk()), mirrored_(mirrored) {}
+
+    void Animate(double delta_time)
+    {
+        sampler_.Advance(delta_time);
+        double sign = mirrored_ ? -1 : 1;
+
+        for (int bone = 0; bone < kRigBoneCount; bone++)
+            if (sampler_.IsPosed(static_cast<RigBone>(bone)))
+                walker_->skeleton.set_angle(walker_->bones[bone], sign * sampler_.get_angle(static_cast<RigBone>(bone)));
+    }
+
+private:
+    Walker *walker_;
+    ClipSampler sampler_;
+    bool mirrored_;
+};
+
+template <typename Animation>
+Animation Make(Walker &walker, bool mirrored);
+
+template <>
+SampledWalk Make<SampledWalk>(Walker &walker, bool mirrored)
+{
+    return SampledWalk(walker, mirrored);
+}
+
+template <>
+AnimationSystem Make<AnimationSystem>(Walker &walker, bool mirrored)
+{
+    return AnimationSystem(&walker.skeleton, walker.bones, mirrored, PoseCache::Walk());
+}
+
+template <typename Animation>
+void Run(const char *label)
+{
+    vector<Walker> walkers;
+    walkers.reserve(kWalkers);
+    for (int i = 0; i < kWalkers; i++)
+        walkers.emplace_back(i);
+
+    vector<Animation> animations;
+    animations.reserve(kWalkers);
+    for (int i = 0; i < kWalkers; i++)
+    {
+        animations.push_back(Make<Animation>(walkers[i], i % 2));
+        animations[i].Animate(i * kStagger);
+        walkers[i].skeleton.get_revision();
+    }
+
+    double animate_time = 0;
+    double compose_time = 0;
+    unsigned long checksum = 0;
+
+    for (int tick = 0; tick < kTicks; tick++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (auto &animation : animations)
+            animation.Animate(kDeltaTime);
+        auto animated = std::chrono::steady_clock::now();
+
+        // Composing the world transforms is what drawing the walkers would cost on top.
+        for (auto &walker : walkers)
+            checksum += walker.skeleton.get_revision();
+        auto composed = std::chrono::steady_clock::now();
+
+        animate_time += std::chrono::duration<double, std::nano>(animated - start).count();
+        compose_time += std::chrono::duration<double, std::nano>(composed - animated).count();
+    }
+
+    double samples = (double)kTicks * kWalkers;
+    cout << label << ": animate " << animate_time / samples
+         << " ns/walker, compose " << compose_time / samples << " ns/walker (checksum " << checksum << ")" << endl;
+}
+
+int main()
+{
+    auto start = std::chrono::steady_clock::now();
+    const PoseCache &cache = PoseCache::Walk();
+    double bake_time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    cout << "walk cache: " << cache.get_frame_count() << " frames of " << cache.get_frame_time() << " ms, baked in " << bake_time << " us; "
+         << kWalkers << " walkers, " << kTicks << " ticks of " << kDeltaTime << " ms" << endl;
+
+    // Interleaved so drift in machine load hits every variant alike.
+    for (int round = 0; round < kRounds; round++)
+    {
+        Run<SampledWalk>("sampled per tick");
+        Run<AnimationSystem>("baked lookup");
+    }
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <GL/gl.h>
+
+#include "../src/graphics/color/rgba.hpp"
+#include "../src/graphics/elements/bullet_system.hpp"
+#include "../src/graphics/elements/character/character.hpp"
+#include "../src/graphics/elements/map.hpp"
+#include "../src/graphics/elements/obstacle.hpp"
+#include "../src/graphics/rendering/batch_renderer.hpp"
+#include "../src/graphics/rendering/gl_render_backend.hpp"
+#include "../src/graphics/rendering/recording_render_backend.hpp"
+#include "../src/graphics/rendering/software_render_backend.hpp"
+#include "../src/graphics/shapes/rectangle.hpp"
+#include "../src/math/vector.hpp"
+#include "offscreen_context.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::elements::BulletSystem;
+using ::graphics::elements::Map;
+using ::graphics::elements::Obstacle;
+using ::graphics::elements::character::Character;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::GLRenderBackend;
+using ::graphics::rendering::RecordingRenderBackend;
+using ::graphics::rendering::SoftwareRenderBackend;
+using ::graphics::shapes::Rectangle;
+using ::math::Vector;
+using ::std::cout;
+using ::std::endl;
+using ::std::vector;
+
+static const int kWidth = 500;
+static const int kHeight = 500;
+static const double kArenaWidth = 1000;
+static const double kArenaHeight = 500;
+static const double kRealTimeFrame = 1000.0 / 60;
+
+// One frame of a busy level, recorded once and replayed on every backend.
+void RecordFrame(RecordingRenderBackend &frame, int obstacles, int characters, int bullets)
+{
+    RGBA obstacle_color(0, 0, 0);
+    RGBA character_color(255, 0, 0);
+
+    Map map;
+    map.set_background(new Rectangle(Vector::Zero(2), kArenaWidth, kArenaHeight, RGBA(0, 0, 255)));
+    for (int i = 0; i < obstacles; i++)
+    {
+        Vector origin(2);
+        origin[0] = (i * 37) % static_cast<int>(kArenaWidth - 20);
+        origin[1] = (i * 53) % static_cast<int>(kArenaHeight - 5);
+        map.AddObstacle(new Obstacle(origin, 20, 5, obstacle_color));
+    }
+
+    vector<Character *> scene_characters;
+    for (int i = 0; i < characters; i++)
+    {
+        Vector origin(2);
+        origin[0] = (i * 13) % 980 + 10;
+        origin[1] = (i * 29) % 470 + 10;
+        scene_characters.push_back(new Character(origin, 8, character_color, false));
+    }
+
+    BulletSystem bullet_system(bullets);
+    for (int i = 0; i < bullets; i++)
+        bullet_system.Spawn((i * 7) % 1000, (i * 11) % 500, 0, 0, 1, nullptr);
+
+    BatchRenderer renderer;
+    renderer.set_backend(&frame);
+    renderer.set_pixels_per_unit(kHeight / kArenaHeight);
+
+    renderer.Begin();
+    map.Render(renderer);
+    for (auto &character : scene_characters)
+        character->Render(renderer);
+    bullet_system.Render(renderer);
+    renderer.End();
+
+    for (auto &character : scene_characters)
+        delete character;
+}
+
+double TimeSoftware(const RecordingRenderBackend &frame, SoftwareRenderBackend &backend, int frames)
+{
+    backend.SetProjection(0, kArenaWidth, kArenaHeight, 0, -1, 1);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++)
+    {
+        backend.Clear();
+        frame.Replay(backend);
+        backend.Present();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / frames;
+}
+
+// Share of pixels differing from llvmpipe; only triangle edges are expected to differ.
+double CompareWithGL(const RecordingRenderBackend &frame, const SoftwareRenderBackend &software)
+{
+    glViewport(0, 0, kWidth, kHeight);
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glMatrixMode(GL_MODELVIEW);
+
+    GLRenderBackend gl_backend;
+    gl_backend.SetClearColor(RGBA(0, 0, 0));
+    gl_backend.SetProjection(0, kArenaWidth, kArenaHeight, 0, -1, 1);
+    gl_backend.Clear();
+    frame.Replay(gl_backend);
+    glFinish();
+
+    vector<unsigned char> gl_pixels(kWidth * kHeight * 4);
+    glReadPixels(0, 0, kWidth, kHeight, GL_RGBA, GL_UNSIGNED_BYTE, gl_pixels.data());
+
+    const unsigned char *software_pixels = software.get_pixels();
+    int different = 0;
+    for (int y = 0; y < kHeight; y++)
+    {
+        for (int x = 0; x < kWidth; x++)
+        {
+            // GL rows start at the bottom.
+            const unsigned char *gl_pixel = &gl_pixels[((kHeight - 1 - y) * kWidth + x) * 4];
+            const unsigned char *software_pixel = &software_pixels[(y * kWidth + x) * 4];
+            if (std::abs(gl_pixel[0] - software_pixel[0]) > 1 || std::abs(gl_pixel[1] - software_pixel[1]) > 1 || std::abs(gl_pixel[2] - software_pixel[2]) > 1)
+                different++;
+        }
+    }
+
+    return 100.0 * different / (kWidth * kHeight);
+}
+
+int main()
+{
+    RecordingRenderBackend frame;
+    RecordFrame(frame, 500, 100, 2000);
+    cout << "Frame: " << frame.get_triangle_count() << " triangles, " << frame.get_vertex_count() << " vertices, "
+         << std::thread::hardware_concurrency() << " hardware threads" << endl;
+
+    for (int threads : {1, 2, 4, 8})
+    {
+        SoftwareRenderBackend backend(kWidth, kHeight, threads);
+        TimeSoftware(frame, backend, 5);
+        double frame_ms = TimeSoftware(frame, backend, 200);
+
+        cout << threads << " threads: " << frame_ms << " ms/frame, " << kRealTimeFrame / frame_ms << "x real time at 60 fps" << endl;
+    }
+
+    for (int tile_size : {16, 32, 64, 128})
+    {
+        SoftwareRenderBackend::tile_size_ = tile_size;
+        SoftwareRenderBackend backend(kWidth, kHeight, 1);
+        TimeSoftware(frame, backend, 5);
+        cout << tile_size << "px tiles, 1 thread: " << TimeSoftware(frame, backend, 200) << " ms/frame" << endl;
+    }
+    SoftwareRenderBackend::tile_size_ = 64;
+
+    if (!CreateOffscreenContext(kWidth, kHeight))
+    {
+        cout << "Could not create an offscreen OpenGL context, skipping the comparison" << endl;
+        return 0;
+    }
+
+    SoftwareRenderBackend backend(kWidth, kHeight);
+    TimeSoftware(frame, backend, 1);
+    cout << "Pixels differing from " << glGetString(GL_RENDERER) << ": " << CompareWithGL(frame, backend) << "%" << endl;
+
+    return 0;
+}
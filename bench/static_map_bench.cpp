@@ -0,0 +1,138 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <GL/gl.h>
+
+#include "../src/graphics/color/rgba.hpp"
+#include "../src/graphics/elements/character/character.hpp"
+#include "../src/graphics/elements/map.hpp"
+#include "../src/graphics/elements/obstacle.hpp"
+#include "../src/graphics/rendering/batch_renderer.hpp"
+#include "../src/graphics/rendering/gl_render_backend.hpp"
+#include "../src/graphics/rendering/irender_backend.hpp"
+#include "../src/graphics/rendering/recording_render_backend.hpp"
+#include "../src/graphics/shapes/rectangle.hpp"
+#include "../src/math/vector.hpp"
+#include "offscreen_context.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::elements::Map;
+using ::graphics::elements::Obstacle;
+using ::graphics::elements::character::Character;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::GLRenderBackend;
+using ::graphics::rendering::IRenderBackend;
+using ::graphics::rendering::RecordingRenderBackend;
+using ::graphics::shapes::Rectangle;
+using ::math::Vector;
+using ::std::cout;
+using ::std::endl;
+using ::std::vector;
+
+static const int kWidth = 500;
+static const int kHeight = 500;
+static const double kArenaWidth = 1000;
+static const double kArenaHeight = 500;
+
+void BuildArena(Map &map, vector<Character *> &characters, int obstacles)
+{
+    RGBA background_color(0, 0, 255);
+    RGBA obstacle_color(0, 0, 0);
+    RGBA character_color(255, 0, 0);
+
+    map.set_background(new Rectangle(Vector::Zero(2), kArenaWidth, kArenaHeight, background_color));
+    for (int i = 0; i < obstacles; i++)
+    {
+        Vector origin(2);
+        origin[0] = (i * 37) % static_cast<int>(kArenaWidth - 20);
+        origin[1] = (i * 53) % static_cast<int>(kArenaHeight - 5);
+        map.AddObstacle(new Obstacle(origin, 20, 5, obstacle_color));
+    }
+
+    for (int i = 0; i < 10; i++)
+    {
+        Vector origin(2);
+        origin[0] = i * 90 + 20;
+        origin[1] = 250;
+        characters.push_back(new Character(origin, 4, character_color, false));
+    }
+}
+
+double TimeFrames(IRenderBackend &backend, Map &map, vector<Character *> &characters, BatchRenderer &renderer, int frames, bool finish)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        backend.Clear();
+
+        renderer.Begin();
+        map.Render(renderer);
+        for (auto &character : characters)
+            character->Render(renderer);
+        renderer.End();
+
+        if (finish)
+            glFinish();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / frames;
+}
+
+void RunBenchmark(const char *name, IRenderBackend &backend, int obstacles, int frames, bool finish)
+{
+    Map map;
+    vector<Character *> characters;
+    BuildArena(map, characters, obstacles);
+
+    BatchRenderer renderer;
+    renderer.set_backend(&backend);
+
+    TimeFrames(backend, map, characters, renderer, 2, finish);
+    double dynamic_ms = TimeFrames(backend, map, characters, renderer, frames, finish);
+    int dynamic_vertices = renderer.get_vertex_count();
+
+    auto bake_start = std::chrono::steady_clock::now();
+    map.Bake(renderer);
+    auto bake_end = std::chrono::steady_clock::now();
+    double bake_ms = std::chrono::duration<double, std::milli>(bake_end - bake_start).count();
+
+    TimeFrames(backend, map, characters, renderer, 2, finish);
+    double baked_ms = TimeFrames(backend, map, characters, renderer, frames, finish);
+
+    cout << name << ", " << obstacles << " obstacles: "
+         << "rebuilt " << dynamic_ms << " ms/frame (" << dynamic_vertices << " vertices submitted), "
+         << "baked " << baked_ms << " ms/frame (" << renderer.get_draw_calls() << " draw calls), "
+         << "bake " << bake_ms << " ms, "
+         << dynamic_ms / baked_ms << "x" << endl;
+
+    for (auto &character : characters)
+        delete character;
+}
+
+int main()
+{
+    RecordingRenderBackend recording_backend(false);
+    RunBenchmark("recording", recording_backend, 500, 500, false);
+    RunBenchmark("recording", recording_backend, 5000, 500, false);
+
+    if (!CreateOffscreenContext(kWidth, kHeight))
+    {
+        cout << "Could not create an offscreen OpenGL context, skipping the GL run" << endl;
+        return 0;
+    }
+
+    glViewport(0, 0, kWidth, kHeight);
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(0, kArenaWidth, kArenaHeight, 0, -1, 1);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    GLRenderBackend gl_backend;
+    RunBenchmark(reinterpret_cast<const char *>(glGetString(GL_RENDERER)), gl_backend, 500, 50, true);
+    RunBenchmark(reinterpret_cast<const char *>(glGetString(GL_RENDERER)), gl_backend, 5000, 50, true);
+
+    return 0;
+}
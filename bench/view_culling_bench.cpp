@@ -0,0 +1,179 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <GL/gl.h>
+
+#include "../src/graphics/color/rgba.hpp"
+#include "../src/graphics/elements/bullet_system.hpp"
+#include "../src/graphics/elements/character/character.hpp"
+#include "../src/graphics/elements/map.hpp"
+#include "../src/graphics/elements/obstacle.hpp"
+#include "../src/graphics/elements/shooting_system.hpp"
+#include "../src/graphics/rendering/batch_renderer.hpp"
+#include "../src/graphics/rendering/camera.hpp"
+#include "../src/graphics/rendering/gl_render_backend.hpp"
+#include "../src/graphics/rendering/irender_backend.hpp"
+#include "../src/graphics/rendering/recording_render_backend.hpp"
+#include "../src/graphics/shapes/rectangle.hpp"
+#include "../src/math/vector.hpp"
+#include "../src/physics/icollidable.hpp"
+#include "offscreen_context.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::elements::BulletSystem;
+using ::graphics::elements::Map;
+using ::graphics::elements::Obstacle;
+using ::graphics::elements::ShootingSystem;
+using ::graphics::elements::character::Character;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::Camera;
+using ::graphics::rendering::GLRenderBackend;
+using ::graphics::rendering::IRenderBackend;
+using ::graphics::rendering::RecordingRenderBackend;
+using ::graphics::shapes::Rectangle;
+using ::math::Vector;
+using ::physic::ICollidable;
+using ::std::cout;
+using ::std::endl;
+using ::std::vector;
+
+static const int kWidth = 500;
+static const int kHeight = 500;
+static const double kViewSize = 500;
+static const double kLevelHeight = 500;
+
+struct Level
+{
+    Map map;
+    vector<Character *> enemies;
+    BulletSystem bullets;
+    ShootingSystem shooting_system;
+
+    ~Level()
+    {
+        for (auto &enemy : enemies)
+            delete enemy;
+    }
+};
+
+void BuildLevel(Level &level, double width)
+{
+    RGBA obstacle_color(0, 0, 0);
+    RGBA enemy_color(255, 0, 0);
+
+    level.map.set_background(new Rectangle(Vector::Zero(2), width, kLevelHeight, RGBA(0, 0, 255)));
+    for (int i = 0; i < width / 4; i++)
+    {
+        Vector origin(2);
+        origin[0] = (i * 37) % static_cast<int>(width - 20);
+        origin[1] = (i * 53) % static_cast<int>(kLevelHeight - 5);
+        level.map.AddObstacle(new Obstacle(origin, 20, 5, obstacle_color));
+    }
+
+    level.shooting_system.set_bullet_system(&level.bullets);
+    for (int i = 0; i < width / 50; i++)
+    {
+        Vector origin(2);
+        origin[0] = i * 50 + 20;
+        origin[1] = 250;
+        Character *enemy = new Character(origin, 4, enemy_color, false);
+        level.enemies.push_back(enemy);
+        level.shooting_system.AddEnemy(enemy);
+    }
+
+    for (int i = 0; i < width; i++)
+        level.bullets.Spawn((i * 7919) % static_cast<int>(width), (i * 104729) % static_cast<int>(kLevelHeight), 0, 0, 1, nullptr);
+}
+
+double TimeFrames(IRenderBackend &backend, Level &level, Camera *camera, BatchRenderer &renderer, int frames, bool finish)
+{
+    vector<ICollidable *> visible_enemies;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        backend.Clear();
+        renderer.Begin();
+
+        if (camera)
+        {
+            camera->BeginFrame();
+            level.map.Render(renderer, *camera);
+
+            level.shooting_system.QueryVisibleEnemies(*camera, visible_enemies);
+            for (auto &enemy : visible_enemies)
+                static_cast<Character *>(enemy)->Render(renderer);
+
+            level.bullets.Render(renderer, *camera);
+        }
+        else
+        {
+            level.map.Render(renderer);
+            for (auto &enemy : level.enemies)
+                enemy->Render(renderer);
+            level.bullets.Render(renderer);
+        }
+
+        renderer.End();
+
+        if (finish)
+            glFinish();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / frames;
+}
+
+void RunBenchmark(const char *name, IRenderBackend &backend, double width, int frames, bool finish)
+{
+    Level level;
+    BuildLevel(level, width);
+
+    BatchRenderer renderer;
+    renderer.set_backend(&backend);
+    level.map.Bake(renderer);
+
+    Camera camera;
+    camera.Reset(0, 0, kViewSize, kLevelHeight);
+    camera.CenterOn(width / 2);
+
+    TimeFrames(backend, level, nullptr, renderer, 2, finish);
+    double all_ms = TimeFrames(backend, level, nullptr, renderer, frames, finish);
+    int all_vertices = renderer.get_vertex_count();
+
+    TimeFrames(backend, level, &camera, renderer, 2, finish);
+    double culled_ms = TimeFrames(backend, level, &camera, renderer, frames, finish);
+
+    cout << name << ", level " << width << " wide: "
+         << "everything " << all_ms << " ms/frame (" << all_vertices << " vertices), "
+         << "culled " << culled_ms << " ms/frame (" << renderer.get_vertex_count() << " vertices, "
+         << camera.get_visible_count() << " visible, " << camera.get_culled_count() << " culled), "
+         << all_ms / culled_ms << "x" << endl;
+}
+
+int main()
+{
+    RecordingRenderBackend recording_backend(false);
+    RunBenchmark("recording", recording_backend, 2000, 500, false);
+    RunBenchmark("recording", recording_backend, 20000, 200, false);
+
+    if (!CreateOffscreenContext(kWidth, kHeight))
+    {
+        cout << "Could not create an offscreen OpenGL context, skipping the GL run" << endl;
+        return 0;
+    }
+
+    double center = 10000;
+    glViewport(0, 0, kWidth, kHeight);
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(center - kViewSize / 2, center + kViewSize / 2, kLevelHeight, 0, -1, 1);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    GLRenderBackend gl_backend;
+    RunBenchmark(reinterpret_cast<const char *>(glGetString(GL_RENDERER)), gl_backend, 20000, 50, true);
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include "activity_scheduler.hpp"
+
+#include <algorithm>
+
+#include "../math/vector.hpp"
+#include "../physics/icollidable.hpp"
+
+using ::math::Vector;
+using ::physic::ICollidable;
+using ::shoot_and_jump::ActivityScheduler;
+using ::shoot_and_jump::ActivityTier;
+using ::std::max;
+
+#pragma region Public Methods
+void ActivityScheduler::AddEntity(ICollidable *entity)
+{
+    if (indices_.count(entity))
+        return;
+
+    indices_[entity] = entries_.size();
+    entries_.push_back({entity, ActivityTier::kEveryTick, 0, 0, true});
+}
+
+void ActivityScheduler::RemoveEntity(ICollidable *entity)
+{
+    auto it = indices_.find(entity);
+    if (it == indices_.end())
+        return;
+
+    size_t index = it->second;
+    indices_.erase(it);
+
+    if (index != entries_.size() - 1)
+    {
+        entries_[index] = entries_.back();
+        indices_[entries_[index].entity] = index;
+    }
+    entries_.pop_back();
+}
+
+void ActivityScheduler::Promote(ICollidable *entity)
+{
+    auto it = indices_.find(entity);
+    if (it == indices_.end())
+        return;
+
+    Entry &entry = entries_[it->second];
+    entry.tier = ActivityTier::kEveryTick;
+    entry.hold_ticks = promotion_hold_ticks_;
+    entry.due = true;
+}
+
+void ActivityScheduler::Schedule(double view_left, double view_top, double view_right, double view_bottom, double delta_time)
+{
+    tick_++;
+    tier_counts_[0] = tier_counts_[1] = tier_counts_[2] = 0;
+
+    for (size_t i = 0; i < entries_.size(); i++)
+    {
+        Entry &entry = entries_[i];
+        ActivityTier tier = ClassifyTier(entry.entity, view_left, view_top, view_right, view_bottom);
+
+        if (entry.hold_ticks > 0)
+        {
+            entry.hold_ticks--;
+            tier = ActivityTier::kEveryTick;
+        }
+
+        // Dormant entities are frozen, so they must not wake up with a huge step.
+        if (tier == ActivityTier::kDormant)
+            entry.accumulated_time = 0;
+        else
+            entry.accumulated_time += delta_time;
+
+        entry.tier = tier;
+
+        if (tier == ActivityTier::kEveryTick)
+            entry.due = true;
+        else if (tier == ActivityTier::kEveryFourthTick)
+            entry.due = (tick_ + i) % every_fourth_tick_period_ == 0;
+        else
+            entry.due = false;
+
+        tier_counts_[static_cast<int>(tier)]++;
+    }
+}
+
+bool ActivityScheduler::IsDue(ICollidable *entity) const
+{
+    auto it = indices_.find(entity);
+    if (it == indices_.end())
+        return true;
+
+    return entries_[it->second].due;
+}
+
+double ActivityScheduler::ConsumeAccumulatedTime(ICollidable *entity)
+{
+    auto it = indices_.find(entity);
+    if (it == indices_.end())
+        return 0;
+
+    Entry &entry = entries_[it->second];
+    double accumulated_time = entry.accumulated_time;
+    entry.accumulated_time = 0;
+    return accumulated_time;
+}
+
+ActivityTier ActivityScheduler::get_tier(ICollidable *entity) const
+{
+    auto it = indices_.find(entity);
+    if (it == indices_.end())
+        return ActivityTier::kEveryTick;
+
+    return entries_[it->second].tier;
+}
+
+int ActivityScheduler::get_tier_count(ActivityTier tier) const
+{
+    return tier_counts_[static_cast<int>(tier)];
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+ActivityTier ActivityScheduler::ClassifyTier(ICollidable *entity, double view_left, double view_top, double view_right, double view_bottom) const
+{
+    Vector position = entity->get_position();
+    double left = position[0];
+    double top = position[1];
+    double right = left + entity->get_width();
+    double bottom = top + entity->get_height();
+
+    double gap_x = max(0.0, max(view_left - right, left - view_right));
+    double gap_y = max(0.0, max(view_top - bottom, top - view_bottom));
+    double gap = max(gap_x, gap_y);
+
+    double view_size = max(view_right - view_left, view_bottom - view_top);
+
+    if (gap <= view_size * near_margin_factor_)
+        return ActivityTier::kEveryTick;
+
+    if (gap <= view_size * far_margin_factor_)
+        return ActivityTier::kEveryFourthTick;
+
+    return ActivityTier::kDormant;
+}
+#pragma endregion // Private Methods
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "../physics/icollidable.hpp"
+
+namespace shoot_and_jump
+{
+    enum class ActivityTier
+    {
+        kEveryTick,
+        kEveryFourthTick,
+        kDormant
+    };
+
+    class ActivityScheduler
+    {
+    public:
+        void AddEntity(physic::ICollidable *entity);
+        void RemoveEntity(physic::ICollidable *entity);
+
+        // Forces the entity into the every tick tier and keeps it there for a while.
+        void Promote(physic::ICollidable *entity);
+
+        // Recomputes tiers from the visible rectangle and advances every entity's clock.
+        void Schedule(double view_left, double view_top, double view_right, double view_bottom, double delta_time);
+
+        bool IsDue(physic::ICollidable *entity) const;
+        double ConsumeAccumulatedTime(physic::ICollidable *entity);
+
+        ActivityTier get_tier(physic::ICollidable *entity) const;
+        int get_tier_count(ActivityTier tier) const;
+
+        inline static double near_margin_factor_ = 0.5;
+        inline static double far_margin_factor_ = 3;
+        inline static int every_fourth_tick_period_ = 4;
+        inline static int promotion_hold_ticks_ = 120;
+
+    private:
+        struct Entry
+        {
+            physic::ICollidable *entity;
+            ActivityTier tier;
+            double accumulated_time;
+            int hold_ticks;
+            bool due;
+        };
+
+        std::vector<Entry> entries_;
+        std::unordered_map<physic::ICollidable *, size_t> indices_;
+        unsigned long tick_ = 0;
+        int tier_counts_[3] = {0, 0, 0};
+
+        ActivityTier ClassifyTier(physic::ICollidable *entity, double view_left, double view_top, double view_right, double view_bottom) const;
+    };
+}
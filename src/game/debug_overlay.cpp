@@ -0,0 +1,122 @@
+#include "debug_overlay.hpp"
+
+#include <string>
+
+#include "../graphics/color/rgba.hpp"
+#include "../graphics/rendering/bitmap_font.hpp"
+#include "../graphics/rendering/mesh_template_registry.hpp"
+#include "../math/affine_transform.hpp"
+#include "../math/vector.hpp"
+#include "../physics/contact.hpp"
+#include "../physics/icollidable.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::elements::BulletSystem;
+using ::graphics::elements::ShootingSystem;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::BitmapFont;
+using ::graphics::rendering::Camera;
+using ::graphics::rendering::MeshTemplateRegistry;
+using ::math::AffineTransform;
+using ::math::Vector;
+using ::physic::CollisionSystem;
+using ::physic::Contact;
+using ::physic::SpatialGrid;
+using ::shoot_and_jump::DebugOverlay;
+
+#pragma region Public Methods
+void DebugOverlay::Render(BatchRenderer &renderer, const Camera &camera, const CollisionSystem &collision_system, const ShootingSystem &shooting_system, const BulletSystem &bullet_system)
+{
+    if (!visible_)
+        return;
+
+    RenderCells(renderer, camera, shooting_system.get_obstacle_grid(), obstacle_cell_color_);
+    RenderCells(renderer, camera, shooting_system.get_enemy_grid(), enemy_cell_color_);
+
+    for (auto &collidable : collision_system.get_collidables())
+    {
+        Vector position = collidable->get_position();
+        double width = collidable->get_width();
+        double height = collidable->get_height();
+        if (camera.IsVisible(position[0], position[1], width, height))
+            RenderBox(renderer, position[0], position[1], width, height, box_color_);
+    }
+
+    for (int i = 0; i < bullet_system.get_size(); i++)
+    {
+        double x = bullet_system.get_x(i);
+        double y = bullet_system.get_y(i);
+        double radius = bullet_system.get_radius(i);
+        if (!camera.IsVisible(x - radius, y - radius, radius * 2, radius * 2))
+            continue;
+
+        double start_x = x - bullet_system.get_velocity_x(i) * sweep_time_;
+        double start_y = y - bullet_system.get_velocity_y(i) * sweep_time_;
+        renderer.SubmitLine(start_x, start_y, x, y, line_width_, bullet_color_);
+        RenderBox(renderer, x - radius, y - radius, radius * 2, radius * 2, bullet_color_);
+    }
+
+    for (auto &contact : collision_system.get_contacts())
+    {
+        double half = contact_size_ / 2;
+        renderer.SubmitMesh(MeshTemplateRegistry::get_unit_quad(), contact_color_, AffineTransform(contact_size_, 0, 0, contact_size_, contact.x - half, contact.y - half));
+        renderer.SubmitLine(contact.x, contact.y, contact.x + contact.normal_x * normal_length_, contact.y + contact.normal_y * normal_length_, line_width_, contact_color_);
+    }
+}
+
+void DebugOverlay::Toggle()
+{
+    visible_ = !visible_;
+}
+
+void DebugOverlay::set_visible(bool visible)
+{
+    visible_ = visible;
+}
+
+bool DebugOverlay::IsVisible() const
+{
+    return visible_;
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void DebugOverlay::RenderCells(BatchRenderer &renderer, const Camera &camera, const SpatialGrid &grid, const RGBA &color)
+{
+    double cell_size = grid.get_cell_size();
+
+    cells_.clear();
+    grid.QueryCells(camera.get_left(), camera.get_top(), camera.get_width(), camera.get_height(), cells_);
+
+    for (auto &cell : cells_)
+    {
+        double x = cell.cell_x * cell_size;
+        double y = cell.cell_y * cell_size;
+        RenderBox(renderer, x, y, cell_size, cell_size, color);
+        RenderNumber(renderer, x + line_width_ * 2, y + line_width_ * 2, cell.count, color);
+    }
+}
+
+void DebugOverlay::RenderBox(BatchRenderer &renderer, double x, double y, double width, double height, const RGBA &color)
+{
+    renderer.SubmitLine(x, y, x + width, y, line_width_, color);
+    renderer.SubmitLine(x + width, y, x + width, y + height, line_width_, color);
+    renderer.SubmitLine(x + width, y + height, x, y + height, line_width_, color);
+    renderer.SubmitLine(x, y + height, x, y, line_width_, color);
+}
+
+void DebugOverlay::RenderNumber(BatchRenderer &renderer, double x, double y, int number, const RGBA &color)
+{
+    std::string digits = std::to_string(number);
+
+    for (size_t i = 0; i < digits.size(); i++)
+    {
+        double left = x + i * BitmapFont::advance_ * text_pixel_size_;
+        for (auto &rect : BitmapFont::get_glyph(digits[i]))
+        {
+            AffineTransform placement(rect.width * text_pixel_size_, 0, 0, rect.height * text_pixel_size_, left + rect.x * text_pixel_size_, y + rect.y * text_pixel_size_);
+            renderer.SubmitMesh(MeshTemplateRegistry::get_unit_quad(), color, placement);
+        }
+    }
+}
+#pragma endregion // Private Methods
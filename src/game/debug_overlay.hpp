@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include "../graphics/color/rgba.hpp"
+#include "../graphics/color/palette.hpp"
+#include "../graphics/elements/bullet_system.hpp"
+#include "../graphics/elements/shooting_system.hpp"
+#include "../graphics/rendering/batch_renderer.hpp"
+#include "../graphics/rendering/camera.hpp"
+#include "../physics/collision_system.hpp"
+#include "../physics/spatial_grid.hpp"
+
+namespace shoot_and_jump
+{
+    // World-space view of what the collision code is doing: occupied broadphase cells
+    // with how many colliders share them, collider and bullet boxes, the contacts found
+    // by the last collision pass with their normals, and each bullet's path over the
+    // last sweep_time_. Everything goes through the frame's BatchRenderer, so turning it
+    // on only adds vertices to the batch the frame already draws.
+    class DebugOverlay
+    {
+    public:
+        void Render(graphics::rendering::BatchRenderer &renderer, const graphics::rendering::Camera &camera,
+                    const physic::CollisionSystem &collision_system, const graphics::elements::ShootingSystem &shooting_system,
+                    const graphics::elements::BulletSystem &bullet_system);
+
+        void Toggle();
+        void set_visible(bool visible);
+        bool IsVisible() const;
+
+        inline static double line_width_ = 0.3;
+        // World units per pixel of the occupancy digits.
+        inline static double text_pixel_size_ = 0.5;
+        inline static double contact_size_ = 1.5;
+        inline static double normal_length_ = 4;
+        // Milliseconds of travel drawn behind each bullet.
+        inline static double sweep_time_ = 1000.0 / 60;
+
+        inline static graphics::color::RGBA obstacle_cell_color_ = graphics::color::RGBA(0, 200, 200);
+        inline static graphics::color::RGBA enemy_cell_color_ = graphics::color::RGBA(220, 0, 220);
+        inline static graphics::color::RGBA box_color_ = graphics::color::palette::kGreen;
+        inline static graphics::color::RGBA bullet_color_ = graphics::color::palette::kWhite;
+        inline static graphics::color::RGBA contact_color_ = graphics::color::palette::kYellow;
+
+    private:
+        bool visible_ = false;
+        std::vector<physic::SpatialGrid::CellOccupancy> cells_;
+
+        void RenderCells(graphics::rendering::BatchRenderer &renderer, const graphics::rendering::Camera &camera, const physic::SpatialGrid &grid, const graphics::color::RGBA &color);
+        void RenderBox(graphics::rendering::BatchRenderer &renderer, double x, double y, double width, double height, const graphics::color::RGBA &color);
+        void RenderNumber(graphics::rendering::BatchRenderer &renderer, double x, double y, int number, const graphics::color::RGBA &color);
+    };
+}
@@ -0,0 +1,64 @@
+#include "dirty_tracker.hpp"
+
+using ::shoot_and_jump::DirtyTracker;
+
+#pragma region Public Methods
+void DirtyTracker::MarkDirty()
+{
+    dirty_ = true;
+}
+
+void DirtyTracker::Observe(const void *object, unsigned long revision, bool visible)
+{
+    auto it = observations_.find(object);
+    if (it == observations_.end())
+    {
+        observations_[object] = {revision, visible};
+        dirty_ = dirty_ || visible;
+        return;
+    }
+
+    Observation &observation = it->second;
+    if (observation.revision != revision && (visible || observation.visible))
+        dirty_ = true;
+
+    observation.revision = revision;
+    observation.visible = visible;
+}
+
+void DirtyTracker::Forget(const void *object)
+{
+    auto it = observations_.find(object);
+    if (it == observations_.end())
+        return;
+
+    dirty_ = dirty_ || it->second.visible;
+    observations_.erase(it);
+}
+
+void DirtyTracker::ObserveCamera(double left, double top)
+{
+    if (left == camera_left_ && top == camera_top_)
+        return;
+
+    camera_left_ = left;
+    camera_top_ = top;
+    dirty_ = true;
+}
+
+bool DirtyTracker::Consume(double elapsed_time)
+{
+    time_since_refresh_ += elapsed_time;
+    if (!dirty_ && time_since_refresh_ < forced_refresh_interval_)
+        return false;
+
+    dirty_ = false;
+    time_since_refresh_ = 0;
+    return true;
+}
+
+bool DirtyTracker::IsDirty() const
+{
+    return dirty_;
+}
+#pragma endregion // Public Methods
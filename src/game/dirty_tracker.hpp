@@ -0,0 +1,42 @@
+#pragma once
+
+#include <unordered_map>
+
+namespace shoot_and_jump
+{
+    // Remembers whether anything on screen changed since the last presented frame, so an
+    // idle scene is not recorded and drawn again every tick.
+    class DirtyTracker
+    {
+    public:
+        void MarkDirty();
+
+        // Marks the scene dirty when the object's revision moved while it was, or just
+        // became, visible. Objects seen for the first time count as spawns.
+        void Observe(const void *object, unsigned long revision, bool visible);
+        // Forgets a despawned object; it disappearing from view is a change.
+        void Forget(const void *object);
+        void ObserveCamera(double left, double top);
+
+        // True when a frame should be presented: something changed, or
+        // forced_refresh_interval_ milliseconds passed since the last one. Clears the state.
+        bool Consume(double elapsed_time);
+        bool IsDirty() const;
+
+        // Longest time without a frame, in milliseconds. Zero presents every tick.
+        inline static double forced_refresh_interval_ = 1000;
+
+    private:
+        struct Observation
+        {
+            unsigned long revision;
+            bool visible;
+        };
+
+        std::unordered_map<const void *, Observation> observations_;
+        bool dirty_ = true;
+        double camera_left_ = 0;
+        double camera_top_ = 0;
+        double time_since_refresh_ = 0;
+    };
+}
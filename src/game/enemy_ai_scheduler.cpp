@@ -0,0 +1,168 @@
+#include "enemy_ai_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "../math/vector.hpp"
+#include "../physics/direction.hpp"
+#include "../graphics/elements/character/character.hpp"
+#include "../graphics/elements/bullet_system.hpp"
+#include "../graphics/elements/particle_system.hpp"
+#include "activity_scheduler.hpp"
+
+using ::graphics::elements::BulletSystem;
+using ::graphics::elements::ParticleSystem;
+using ::graphics::elements::character::Character;
+using ::math::Vector;
+using ::physic::Direction;
+using ::shoot_and_jump::ActivityScheduler;
+using ::shoot_and_jump::ActivityTier;
+using ::shoot_and_jump::EnemyAIScheduler;
+using ::std::max;
+using ::std::min;
+
+#pragma region Public Methods
+void EnemyAIScheduler::AddAgent(Character *enemy, double patrol_left, double patrol_right)
+{
+    if (indices_.count(enemy))
+        return;
+
+    Agent agent;
+    agent.enemy = enemy;
+    agent.patrol_left = patrol_left;
+    agent.patrol_right = patrol_right;
+    agent.patrol_direction = agents_.size() % 2 == 0 ? Direction::kLeft : Direction::kRight;
+    // Stagger the first shots so a group of enemies does not fire in lockstep.
+    agent.cooldown = fire_cooldown_ * (1 + agents_.size() % 4 / 4.0);
+    agent.engaged = false;
+    agent.facing = agent.patrol_direction;
+    agent.aim_angle = 0;
+
+    indices_[enemy] = agents_.size();
+    agents_.push_back(agent);
+}
+
+void EnemyAIScheduler::RemoveAgent(Character *enemy)
+{
+    auto it = indices_.find(enemy);
+    if (it == indices_.end())
+        return;
+
+    size_t index = it->second;
+    indices_.erase(it);
+
+    if (index != agents_.size() - 1)
+    {
+        agents_[index] = agents_.back();
+        indices_[agents_[index].enemy] = index;
+    }
+    agents_.pop_back();
+
+    if (cursor_ >= agents_.size())
+        cursor_ = 0;
+}
+
+void EnemyAIScheduler::Think(Character *player, const ActivityScheduler &activity_scheduler)
+{
+    agents_processed_ = 0;
+    if (agents_.empty())
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+
+    // Visit each agent at most once per tick, and always at least one so the round advances.
+    for (size_t visited = 0; visited < agents_.size(); visited++)
+    {
+        Agent &agent = agents_[cursor_];
+        cursor_ = (cursor_ + 1) % agents_.size();
+
+        if (activity_scheduler.get_tier(agent.enemy) == ActivityTier::kDormant)
+            continue;
+
+        Decide(agent, player);
+        agents_processed_++;
+
+        elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= think_budget_microseconds_)
+            break;
+    }
+
+    if (elapsed > think_budget_microseconds_)
+        budget_overruns_++;
+}
+
+void EnemyAIScheduler::Act(Character *enemy, double delta_time, BulletSystem &bullet_system, ParticleSystem *particle_system)
+{
+    auto it = indices_.find(enemy);
+    if (it == indices_.end())
+    {
+        enemy->Stop(delta_time);
+        return;
+    }
+
+    Agent &agent = agents_[it->second];
+    agent.cooldown -= delta_time;
+
+    if (agent.engaged)
+    {
+        enemy->Stop(delta_time);
+        enemy->Face(agent.facing);
+        enemy->Aim(agent.aim_angle);
+
+        if (agent.cooldown <= 0)
+        {
+            enemy->Shoot(bullet_system, particle_system);
+            agent.cooldown = fire_cooldown_;
+        }
+        return;
+    }
+
+    double left = enemy->get_position()[0];
+    double right = left + enemy->get_width();
+
+    if (agent.patrol_direction == Direction::kLeft && left <= agent.patrol_left)
+        agent.patrol_direction = Direction::kRight;
+    else if (agent.patrol_direction == Direction::kRight && right >= agent.patrol_right)
+        agent.patrol_direction = Direction::kLeft;
+
+    if (agent.patrol_right - agent.patrol_left <= enemy->get_width())
+        enemy->Stop(delta_time);
+    else
+        enemy->Move(delta_time, agent.patrol_direction);
+}
+
+int EnemyAIScheduler::get_agents_processed() const
+{
+    return agents_processed_;
+}
+
+unsigned long EnemyAIScheduler::get_budget_overruns() const
+{
+    return budget_overruns_;
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void EnemyAIScheduler::Decide(Agent &agent, Character *player)
+{
+    Vector enemy_position = agent.enemy->get_position();
+    Vector player_position = player->get_position();
+
+    double dx = (player_position[0] + player->get_width() / 2) - (enemy_position[0] + agent.enemy->get_width() / 2);
+    double dy = (player_position[1] + player->get_height() / 2) - (enemy_position[1] + agent.enemy->get_height() / 2);
+
+    agent.engaged = std::abs(dx) <= sight_range_ && std::abs(dy) <= sight_height_;
+    if (!agent.engaged)
+        return;
+
+    agent.facing = dx < 0 ? Direction::kLeft : Direction::kRight;
+
+    // Gun angles are measured in the facing frame, see Gun::Shoot.
+    double angle = agent.facing == Direction::kRight ? atan2(dy, dx) : atan2(-dy, -dx);
+    angle = max(angle, -M_PI / 4);
+    angle = min(angle, M_PI / 4);
+    agent.aim_angle = angle;
+}
+#pragma endregion // Private Methods
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "../graphics/elements/character/character.hpp"
+#include "../graphics/elements/bullet_system.hpp"
+#include "../graphics/elements/particle_system.hpp"
+#include "../physics/direction.hpp"
+#include "activity_scheduler.hpp"
+
+namespace shoot_and_jump
+{
+    // Spreads enemy decisions over several ticks under a wall clock budget. Think only
+    // refreshes each agent's plan; Act carries the plan out whenever the activity
+    // scheduler says the enemy is due, with the time it accumulated meanwhile.
+    class EnemyAIScheduler
+    {
+    public:
+        void AddAgent(graphics::elements::character::Character *enemy, double patrol_left, double patrol_right);
+        void RemoveAgent(graphics::elements::character::Character *enemy);
+
+        void Think(graphics::elements::character::Character *player, const ActivityScheduler &activity_scheduler);
+        void Act(graphics::elements::character::Character *enemy, double delta_time, graphics::elements::BulletSystem &bullet_system, graphics::elements::ParticleSystem *particle_system = nullptr);
+
+        int get_agents_processed() const;
+        unsigned long get_budget_overruns() const;
+
+        inline static double think_budget_microseconds_ = 250;
+        inline static double sight_range_ = 60;
+        inline static double sight_height_ = 25;
+        inline static double fire_cooldown_ = 1500;
+
+    private:
+        struct Agent
+        {
+            graphics::elements::character::Character *enemy;
+            double patrol_left;
+            double patrol_right;
+            physic::Direction patrol_direction;
+            double cooldown;
+
+            bool engaged;
+            physic::Direction facing;
+            double aim_angle;
+        };
+
+        std::vector<Agent> agents_;
+        std::unordered_map<graphics::elements::character::Character *, size_t> indices_;
+        size_t cursor_ = 0;
+
+        int agents_processed_ = 0;
+        unsigned long budget_overruns_ = 0;
+
+        void Decide(Agent &agent, graphics::elements::character::Character *player);
+    };
+}
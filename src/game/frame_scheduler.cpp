@@ -0,0 +1,130 @@
+#include "frame_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <thread>
+
+using ::shoot_and_jump::FrameScheduler;
+using ::std::chrono::duration;
+using ::std::chrono::duration_cast;
+
+#pragma region Constructors and Destructors
+FrameScheduler::FrameScheduler(double target_fps)
+{
+    target_fps_ = target_fps;
+    focused_ = true;
+    next_frame_ = Clock::now();
+
+    has_last_frame_ = false;
+    window_start_ = Clock::now();
+    window_cpu_start_ = std::clock();
+    window_frames_ = 0;
+    window_sum_ = 0;
+    window_sum_squares_ = 0;
+
+    frame_rate_ = 0;
+    frame_time_ = 0;
+    jitter_ = 0;
+    cpu_utilization_ = 0;
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+void FrameScheduler::WaitForNextFrame()
+{
+    Clock::time_point now = Clock::now();
+    if (now < next_frame_)
+    {
+        std::this_thread::sleep_until(next_frame_);
+        next_frame_ += get_period();
+        return;
+    }
+
+    // More than a frame behind: start over from now instead of rushing to catch up.
+    next_frame_ += get_period();
+    if (next_frame_ < now)
+        next_frame_ = now + get_period();
+}
+
+void FrameScheduler::MarkFrame()
+{
+    Clock::time_point now = Clock::now();
+
+    if (has_last_frame_)
+    {
+        double frame_time = duration<double, std::milli>(now - last_frame_).count();
+        window_frames_++;
+        window_sum_ += frame_time;
+        window_sum_squares_ += frame_time * frame_time;
+    }
+    last_frame_ = now;
+    has_last_frame_ = true;
+
+    if (duration<double, std::milli>(now - window_start_).count() >= report_interval_)
+        CloseWindow(now);
+}
+
+void FrameScheduler::set_target_fps(double target_fps)
+{
+    target_fps_ = target_fps;
+}
+
+void FrameScheduler::set_focused(bool focused)
+{
+    focused_ = focused;
+}
+
+bool FrameScheduler::IsFocused() const
+{
+    return focused_;
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+FrameScheduler::Clock::duration FrameScheduler::get_period() const
+{
+    double fps = !focused_ && throttle_unfocused_ ? unfocused_fps_ : target_fps_;
+    return duration_cast<Clock::duration>(duration<double>(1 / fps));
+}
+
+void FrameScheduler::CloseWindow(Clock::time_point now)
+{
+    double wall_time = duration<double, std::milli>(now - window_start_).count();
+    double cpu_time = 1000.0 * (std::clock() - window_cpu_start_) / CLOCKS_PER_SEC;
+
+    frame_rate_ = window_frames_ * 1000 / wall_time;
+    frame_time_ = window_frames_ > 0 ? window_sum_ / window_frames_ : 0;
+    jitter_ = window_frames_ > 0 ? std::sqrt(std::max(0.0, window_sum_squares_ / window_frames_ - frame_time_ * frame_time_)) : 0;
+    cpu_utilization_ = 100 * cpu_time / wall_time;
+
+    window_start_ = now;
+    window_cpu_start_ = std::clock();
+    window_frames_ = 0;
+    window_sum_ = 0;
+    window_sum_squares_ = 0;
+}
+#pragma endregion // Private Methods
+
+#pragma region Getters
+double FrameScheduler::get_frame_rate() const
+{
+    return frame_rate_;
+}
+
+double FrameScheduler::get_frame_time() const
+{
+    return frame_time_;
+}
+
+double FrameScheduler::get_jitter() const
+{
+    return jitter_;
+}
+
+double FrameScheduler::get_cpu_utilization() const
+{
+    return cpu_utilization_;
+}
+#pragma endregion // Getters
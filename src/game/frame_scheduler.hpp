@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <ctime>
+
+namespace shoot_and_jump
+{
+    // Paces the GLUT loop to a target frame rate with timed sleeps instead of polling, and
+    // drops to a lower rate while the window is unfocused. Frame time, jitter and process
+    // CPU use are measured over fixed windows so the modes can be compared.
+    class FrameScheduler
+    {
+    public:
+        FrameScheduler(double target_fps = default_target_fps_);
+
+        // Sleeps until the next frame is due; returns at once when already late.
+        void WaitForNextFrame();
+        // Call once per presented frame.
+        void MarkFrame();
+
+        void set_target_fps(double target_fps);
+        void set_focused(bool focused);
+        bool IsFocused() const;
+
+        // Values of the last complete measurement window.
+        double get_frame_rate() const;
+        double get_frame_time() const;
+        double get_jitter() const;
+        double get_cpu_utilization() const;
+
+        inline static double default_target_fps_ = 60;
+        inline static double unfocused_fps_ = 10;
+        inline static bool throttle_unfocused_ = true;
+        // Milliseconds per measurement window.
+        inline static double report_interval_ = 1000;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        double target_fps_;
+        bool focused_;
+        Clock::time_point next_frame_;
+
+        Clock::time_point last_frame_;
+        bool has_last_frame_;
+        Clock::time_point window_start_;
+        std::clock_t window_cpu_start_;
+        int window_frames_;
+        double window_sum_;
+        double window_sum_squares_;
+
+        double frame_rate_;
+        double frame_time_;
+        double jitter_;
+        double cpu_utilization_;
+
+        Clock::duration get_period() const;
+        void CloseWindow(Clock::time_point now);
+    };
+}
@@ -2,26 +2,49 @@
 
 #include <iostream>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <thread>
 #include <tuple>
+#include <string>
 
 #include <GL/glut.h>
 
 #include "../math/vector.hpp"
 #include "../graphics/color/rgba_factory.hpp"
+#include "../graphics/color/palette.hpp"
 #include "../graphics/color/rgba.hpp"
 #include "../graphics/shapes/circle.hpp"
 #include "../graphics/shapes/rectangle.hpp"
 #include "../graphics/elements/obstacle.hpp"
-#include "../graphics/elements/bullet.hpp"
+#include "../graphics/elements/bullet_system.hpp"
+#include "../graphics/elements/bullet_emitter.hpp"
+#include "../graphics/elements/bullet_pattern.hpp"
+#include "../graphics/elements/hit_event.hpp"
+#include "../graphics/rendering/camera.hpp"
+#include "../graphics/rendering/gl_render_backend.hpp"
+#include "../graphics/rendering/irender_backend.hpp"
+#include "../graphics/rendering/software_render_backend.hpp"
 #include "../physics/direction.hpp"
 
+namespace palette = ::graphics::color::palette;
 using ::graphics::color::ColorOption;
 using ::graphics::color::RGBA;
 using ::graphics::color::RGBAFactory;
-using ::graphics::elements::Bullet;
+using ::graphics::elements::BulletEmitter;
+using ::graphics::elements::BulletPattern;
+using ::graphics::elements::HitTarget;
 using ::graphics::elements::Obstacle;
+using ::graphics::elements::ParticleSystem;
+using ::graphics::elements::PatternKind;
 using ::graphics::elements::character::Character;
+using ::graphics::elements::character::GroundedState;
+using ::graphics::rendering::GLRenderBackend;
+using ::graphics::rendering::IRenderBackend;
+using ::graphics::rendering::SoftwareRenderBackend;
 using ::graphics::shapes::Circle;
 using ::graphics::shapes::Rectangle;
 using ::math::Vector;
@@ -34,7 +57,6 @@ using ::std::endl;
 using ::std::get;
 using ::std::max;
 using ::std::min;
-using ::std::remove;
 using ::std::string;
 
 namespace shoot_and_jump
@@ -71,10 +93,23 @@ namespace shoot_and_jump
         instance->BindMouseMotion(x, y);
     }
 
+    void entryFunc(int state)
+    {
+        instance->BindWindowEntry(state);
+    }
+
+    // GLUT leaves its main loop through exit, which skips the game's destructor.
+    void stopSimulationFunc()
+    {
+        instance->StopSimulation();
+    }
+
 #pragma region Constructors and Destructors
     Game::Game(string path)
     {
         instance = this;
+        shooting_system_.set_bullet_system(&bullet_system_);
+        render_backend_ = new GLRenderBackend();
         Allocate();
         LoadMap(path);
         get<0>(mouse_position_) = 1;
@@ -84,7 +119,9 @@ namespace shoot_and_jump
 
     Game::~Game()
     {
+        StopSimulation();
         Deallocate();
+        delete render_backend_;
     }
 
     void Game::Allocate()
@@ -96,6 +133,12 @@ namespace shoot_and_jump
         delete player_;
         for (auto enemy : enemies_)
             delete enemy;
+        enemies_.clear();
+        enemy_indices_.clear();
+
+        for (auto emitter : emitters_)
+            delete emitter;
+        emitters_.clear();
     }
 #pragma endregion // Constructors and Destructors
 
@@ -110,57 +153,89 @@ namespace shoot_and_jump
 
         /* selecionar cor de fundo (preto) */
         RGBA scren_color = RGBAFactory::get_color(ColorOption::kBlack);
-        glClearColor(scren_color.get_red(), scren_color.get_green(), scren_color.get_blue(), scren_color.get_alpha());
-
-        glLoadIdentity();
-        glOrtho(ortho_left_, ortho_right_, ortho_bottom_, ortho_top_, ortho_near_, ortho_far_);
+        render_backend_->SetClearColor(scren_color);
 
         glutSetKeyRepeat(GLUT_KEY_REPEAT_OFF);
         glutMouseFunc(mouseFunc);
         glutPassiveMotionFunc(motionPassifeFunc);
+        glutEntryFunc(entryFunc);
         glutKeyboardFunc(keyPressedFunc);
         glutKeyboardUpFunc(keyReleasedFunc);
         glutDisplayFunc(displayFunc);
         glutIdleFunc(idleFunc);
 
+        renderer_.set_pixels_per_unit(window_height_ / camera_.get_height());
+
+        simulating_ = true;
+        simulation_thread_ = std::thread(&Game::Simulate, this);
+        std::atexit(stopSimulationFunc);
+
         glutMainLoop();
     }
 
-    void Game::Idle()
+    void Game::RunHeadless(int frames, string output_prefix)
     {
-        double current_time = glutGet(GLUT_ELAPSED_TIME);
-        delta_time_ = current_time - this->current_time_;
-        if (delta_time_ > 0.1)
-        {
-            this->current_time_ = current_time;
-            Vector old_position = player_->get_position();
-            CheckKeys();
-
-            ProcessAiming();
+        SoftwareRenderBackend backend(window_width_, window_height_);
+        backend.SetClearColor(RGBAFactory::get_color(ColorOption::kBlack));
+        renderer_.set_pixels_per_unit(window_height_ / camera_.get_height());
 
-            for (auto bullet : bullets_)
-                bullet->Update(delta_time_);
+        // Fixed steps, so the same level always renders the same frames on any machine.
+        delta_time_ = min_tick_time_;
+        double simulated_time = 0;
+        int skipped_frames = 0;
 
-            collision_system_.ProcessCollisions();
-            gravity_constraint_system_.ProcessGravityEffects();
-            shooting_system_.ProcessShoots();
+        auto start_time = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++)
+        {
+            auto frame_start_time = std::chrono::steady_clock::now();
+            for (; simulated_time < (frame + 1) * headless_frame_time_; simulated_time += delta_time_)
+                Step();
 
-            for (auto &bullet : shooting_system_.hit_bullets_)
-                bullets_.erase(remove(bullets_.begin(), bullets_.end(), bullet), bullets_.end());
-            shooting_system_.hit_bullets_.clear();
+            // An unchanged scene keeps the previous frame's pixels.
+            if (dirty_tracker_.Consume(headless_frame_time_))
+            {
+                PublishSnapshot(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame_start_time).count());
+                snapshots_.Acquire();
+                ReplaySnapshot(backend, snapshots_.get_read_buffer());
+                if (hud_.IsVisible())
+                {
+                    UpdateHud(snapshots_.get_read_buffer(), headless_frame_time_);
+                    hud_.Draw(backend, window_width_, window_height_);
+                }
+                backend.Present();
+            }
+            else
+                skipped_frames++;
 
-            for (auto &enemy : shooting_system_.hit_enemies_)
+            std::ostringstream path;
+            path << output_prefix << std::setw(5) << std::setfill('0') << frame << ".ppm";
+            if (!backend.WritePPM(path.str()))
             {
-                collision_system_.RemoveFromCollisionSystem(enemy);
-                enemies_.erase(remove(enemies_.begin(), enemies_.end(), enemy), enemies_.end());
+                cout << "Could not write " << path.str() << endl;
+                return;
             }
-            shooting_system_.hit_enemies_.clear();
+        }
 
-            Vector translation = old_position - player_->get_position();
-            glTranslated(translation[0], 0, 0);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        cout << "Rendered " << frames << " frames on " << backend.get_thread_count() << " threads in " << seconds << " s, "
+             << frames * headless_frame_time_ / 1000 / seconds << "x real time, " << skipped_frames << " unchanged frames skipped" << endl;
+    }
 
+    void Game::StopSimulation()
+    {
+        simulating_ = false;
+        if (simulation_thread_.joinable())
+            simulation_thread_.join();
+    }
+
+    void Game::Idle()
+    {
+        frame_scheduler_.WaitForNextFrame();
+
+        if (snapshots_.Acquire())
             glutPostRedisplay();
-        }
+        else
+            skipped_frames_++;
     }
 
     void Game::ProcessAiming()
@@ -169,9 +244,9 @@ namespace shoot_and_jump
         mouse_position[0] = get<0>(mouse_position_);
 
         if (player_->IsLookingRight())
-            mouse_position[1] = ((ortho_bottom_ - player_->get_position()[1]) / (ortho_bottom_ - ortho_top_)) * window_height_ - get<1>(mouse_position_);
+            mouse_position[1] = ((camera_.get_bottom() - player_->get_position()[1]) / camera_.get_height()) * window_height_ - get<1>(mouse_position_);
         else
-            mouse_position[1] = get<1>(mouse_position_) - ((ortho_bottom_ - player_->get_position()[1]) / (ortho_bottom_ - ortho_top_)) * window_height_;
+            mouse_position[1] = get<1>(mouse_position_) - ((camera_.get_bottom() - player_->get_position()[1]) / camera_.get_height()) * window_height_;
 
         double angle = atan2(mouse_position[1], mouse_position[0]);
 
@@ -189,46 +264,215 @@ namespace shoot_and_jump
 
     void Game::Display()
     {
-        glClear(GL_COLOR_BUFFER_BIT);
+        auto start_time = std::chrono::steady_clock::now();
+        const RenderSnapshot &snapshot = snapshots_.get_read_buffer();
 
-        map_.Render();
-        player_->Render();
+        ReplaySnapshot(*render_backend_, snapshot);
+        if (hud_.IsVisible())
+        {
+            UpdateHud(snapshot, frame_scheduler_.get_frame_time());
+            hud_.Draw(*render_backend_, window_width_, window_height_);
+        }
 
-        for (auto &enemy : enemies_)
-            enemy->Render();
+        // The swap may wait for the display, so it is left out of the render time.
+        double render_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+        render_time_ += (render_time - render_time_) * timing_smoothing_;
 
-        for (auto &bullet : bullets_)
-            bullet->Render();
+        render_backend_->Present();
+        frame_scheduler_.MarkFrame();
 
-        glutSwapBuffers();
+        ReportRenderStats(snapshot);
     }
 
     void Game::KeyPressed(unsigned char key, int x, int y)
     {
-        keys_[key] = true;
+        if (key == hud_toggle_key_)
+        {
+            hud_.Toggle();
+            glutPostRedisplay();
+            return;
+        }
+
+        input_queue_.Push({InputEventType::kKeyPressed, key, 0, x, y});
     }
 
     void Game::KeyReleased(unsigned char key, int x, int y)
     {
-        keys_[key] = false;
+        input_queue_.Push({InputEventType::kKeyReleased, key, 0, x, y});
     }
 
     void Game::BindMouseButton(int button, int state, int x, int y)
     {
-        mouse_[button] = state == GLUT_DOWN;
-
-        if (mouse_[GLUT_LEFT_BUTTON] && state != GLUT_UP)
-            shoot_processed_ = false;
+        input_queue_.Push({InputEventType::kMouseButton, button, state, x, y});
     }
 
     void Game::BindMouseMotion(int x, int y)
     {
-        get<0>(mouse_position_) = x - window_width_ / 2;
-        get<1>(mouse_position_) = window_height_ - y;
+        input_queue_.Push({InputEventType::kMouseMotion, 0, 0, x, y});
+    }
+
+    void Game::BindWindowEntry(int state)
+    {
+        frame_scheduler_.set_focused(state == GLUT_ENTERED);
     }
 #pragma endregion // Public Methods
 
 #pragma region Private Methods
+    void Game::Simulate()
+    {
+        auto previous_time = std::chrono::steady_clock::now();
+
+        while (simulating_)
+        {
+            auto start_time = std::chrono::steady_clock::now();
+            delta_time_ = std::chrono::duration<double, std::milli>(start_time - previous_time).count();
+            if (delta_time_ < min_tick_time_)
+            {
+                std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(min_tick_time_ - delta_time_));
+                continue;
+            }
+            previous_time = start_time;
+
+            ApplyInput();
+            Step();
+
+            if (!dirty_tracker_.Consume(delta_time_))
+                continue;
+
+            double simulation_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+            PublishSnapshot(simulation_time);
+        }
+    }
+
+    void Game::Step()
+    {
+        CheckKeys();
+
+        ProcessAiming();
+        UpdateEnemies();
+
+        for (auto &emitter : emitters_)
+            emitter->Update(delta_time_, nullptr, bullet_system_);
+
+        bullet_system_.Update(delta_time_);
+        particle_system_.Update(delta_time_);
+
+        collision_system_.ProcessCollisions();
+        gravity_constraint_system_.ProcessGravityEffects();
+        shooting_system_.ProcessShoots();
+
+        camera_.CenterOn(player_->get_position()[0]);
+
+        ApplyHitEvents();
+        TrackChanges();
+    }
+
+    void Game::ApplyInput()
+    {
+        input_queue_.Drain(input_events_);
+
+        for (auto &event : input_events_)
+        {
+            switch (event.type)
+            {
+            case InputEventType::kKeyPressed:
+                keys_[event.code] = true;
+                if (event.code == debug_overlay_key_)
+                    ToggleDebugOverlay();
+                break;
+            case InputEventType::kKeyReleased:
+                keys_[event.code] = false;
+                break;
+            case InputEventType::kMouseButton:
+                mouse_[event.code] = event.state == GLUT_DOWN;
+                if (mouse_[GLUT_LEFT_BUTTON] && event.state != GLUT_UP)
+                    shoot_processed_ = false;
+                break;
+            case InputEventType::kMouseMotion:
+                get<0>(mouse_position_) = event.x - window_width_ / 2;
+                get<1>(mouse_position_) = window_height_ - event.y;
+                break;
+            }
+        }
+    }
+
+    void Game::TrackChanges()
+    {
+        dirty_tracker_.ObserveCamera(camera_.get_left(), camera_.get_top());
+        dirty_tracker_.Observe(player_, player_->get_revision(), true);
+
+        for (auto &enemy : enemies_)
+        {
+            Vector position = enemy->get_position();
+            bool visible = camera_.IsVisible(position[0], position[1], enemy->get_width(), enemy->get_height());
+            dirty_tracker_.Observe(enemy, enemy->get_revision(), visible);
+        }
+
+        // Live bullets and particles move every tick; the counts also catch the last one expiring.
+        int bullet_count = bullet_system_.get_size();
+        int particle_count = particle_system_.get_size();
+        if (bullet_count > 0 || bullet_count != bullet_count_ || particle_count > 0 || particle_count != particle_count_)
+            dirty_tracker_.MarkDirty();
+        bullet_count_ = bullet_count;
+        particle_count_ = particle_count;
+    }
+
+    void Game::ToggleDebugOverlay()
+    {
+        debug_overlay_.Toggle();
+        collision_system_.set_record_contacts(debug_overlay_.IsVisible());
+        dirty_tracker_.MarkDirty();
+    }
+
+    void Game::PublishSnapshot(double simulation_time)
+    {
+        RenderSnapshot &snapshot = snapshots_.get_write_buffer();
+
+        snapshot.commands.Reset();
+        renderer_.set_backend(&snapshot.commands);
+
+        camera_.BeginFrame();
+        renderer_.Begin();
+
+        map_.Render(renderer_, camera_);
+        player_->Render(renderer_);
+        RenderEnemies();
+        bullet_system_.Render(renderer_, camera_);
+        particle_system_.Render(renderer_, camera_);
+        debug_overlay_.Render(renderer_, camera_, collision_system_, shooting_system_, bullet_system_);
+
+        renderer_.End();
+
+        simulation_time_ += (simulation_time - simulation_time_) * timing_smoothing_;
+
+        snapshot.tick = ++tick_;
+        snapshot.view_left = camera_.get_left();
+        snapshot.view_right = camera_.get_right();
+        snapshot.view_top = camera_.get_top();
+        snapshot.view_bottom = camera_.get_bottom();
+        snapshot.draw_calls = renderer_.get_draw_calls();
+        snapshot.vertex_count = renderer_.get_vertex_count();
+        snapshot.visible_count = camera_.get_visible_count();
+        snapshot.culled_count = camera_.get_culled_count();
+        snapshot.body_count = collision_system_.get_size();
+        snapshot.bullet_count = bullet_system_.get_size();
+        snapshot.pair_test_count = collision_system_.get_pair_test_count();
+        snapshot.agents_processed = enemy_ai_scheduler_.get_agents_processed();
+        snapshot.budget_overruns = enemy_ai_scheduler_.get_budget_overruns();
+        snapshot.simulation_time = simulation_time_;
+
+        snapshots_.Publish();
+    }
+
+    void Game::ReplaySnapshot(IRenderBackend &backend, const RenderSnapshot &snapshot)
+    {
+        if (snapshot.tick > 0)
+            backend.SetProjection(snapshot.view_left, snapshot.view_right, snapshot.view_bottom, snapshot.view_top, ortho_near_, ortho_far_);
+
+        backend.Clear();
+        snapshot.commands.Replay(backend);
+    }
+
     void Game::LoadMap(std::string path)
     {
         tinyxml2::XMLDocument doc;
@@ -264,6 +508,17 @@ namespace shoot_and_jump
 
             rect_element = rect_element->NextSiblingElement("rect");
         }
+
+        tinyxml2::XMLElement *emitter_element = root->FirstChildElement("emitter");
+        while (emitter_element != nullptr)
+        {
+            LoadEmitter(emitter_element);
+            emitter_element = emitter_element->NextSiblingElement("emitter");
+        }
+
+        AssignPatrolRoutes();
+
+        map_.Bake(renderer_);
     }
 
     void Game::LoadBackground(tinyxml2::XMLElement *element)
@@ -285,14 +540,11 @@ namespace shoot_and_jump
 
         Vector player_position = player_->get_position();
 
-        ortho_left_ = player_position[0] - height / 2;
-        ortho_right_ = player_position[0] + height / 2;
-        ortho_top_ = y;
-        ortho_bottom_ = y + height;
+        camera_.Reset(player_position[0] - height / 2, y, height, height);
         ortho_near_ = 20.0;
         ortho_far_ = 0.0;
 
-        RGBA obstacle_color = RGBAFactory::get_color("black");
+        RGBA obstacle_color = palette::kBlack;
 
         double obstacle_stroke = 1;
 
@@ -381,9 +633,214 @@ namespace shoot_and_jump
         RGBA color = RGBAFactory::get_color(fill);
 
         Character *enemy = new Character(origin, radius, color, false);
+        enemy->set_state<GroundedState>();
+        enemy_indices_[enemy] = enemies_.size();
         enemies_.push_back(enemy);
         collision_system_.AddToCollisionSystem(enemy);
         shooting_system_.AddEnemy(enemy);
+        activity_scheduler_.AddEntity(enemy);
+    }
+
+    void Game::UpdateEnemies()
+    {
+        activity_scheduler_.Schedule(camera_.get_left(), camera_.get_top(), camera_.get_right(), camera_.get_bottom(), delta_time_);
+        enemy_ai_scheduler_.Think(player_, activity_scheduler_);
+
+        for (auto &enemy : enemies_)
+        {
+            bool due = activity_scheduler_.IsDue(enemy);
+            collision_system_.set_active(enemy, due);
+
+            if (due)
+                enemy_ai_scheduler_.Act(enemy, activity_scheduler_.ConsumeAccumulatedTime(enemy), bullet_system_, &particle_system_);
+        }
+    }
+
+    void Game::RemoveEnemy(Character *enemy)
+    {
+        auto it = enemy_indices_.find(enemy);
+        if (it == enemy_indices_.end())
+            return;
+
+        size_t index = it->second;
+        enemy_indices_.erase(it);
+
+        if (index != enemies_.size() - 1)
+        {
+            enemies_[index] = enemies_.back();
+            enemy_indices_[enemies_[index]] = index;
+        }
+        enemies_.pop_back();
+
+        collision_system_.RemoveFromCollisionSystem(enemy);
+        shooting_system_.RemoveEnemy(enemy);
+        activity_scheduler_.RemoveEntity(enemy);
+        dirty_tracker_.Forget(enemy);
+        enemy_ai_scheduler_.RemoveAgent(enemy);
+        delete enemy;
+    }
+
+    void Game::ApplyHitEvents()
+    {
+        for (auto &event : shooting_system_.get_hit_events())
+        {
+            // A bullet may report one hit only, so every event is a distinct impact.
+            if (bullet_system_.Despawn(event.bullet))
+                particle_system_.Emit(ParticleSystem::impact_effect_, event.x, event.y, std::atan2(-event.velocity_y, -event.velocity_x));
+
+            // Several bullets may report the same enemy, RemoveEnemy ignores the repeats.
+            if (event.target_type == HitTarget::kEnemy)
+                RemoveEnemy(static_cast<Character *>(event.target));
+        }
+        shooting_system_.ClearHitEvents();
+    }
+
+    void Game::LoadEmitter(tinyxml2::XMLElement *element)
+    {
+        BulletPattern pattern = LoadPattern(element);
+        const char *attach = element->Attribute("attach");
+        string target = attach == nullptr ? "" : attach;
+
+        if (target == "player")
+        {
+            player_->set_fire_pattern(pattern);
+        }
+        else if (target == "enemies")
+        {
+            for (auto &enemy : enemies_)
+                enemy->set_fire_pattern(pattern);
+        }
+        else
+        {
+            double cx = element->DoubleAttribute("cx");
+            double cy = element->DoubleAttribute("cy");
+            emitters_.push_back(new BulletEmitter(pattern, cx, cy));
+        }
+    }
+
+    BulletPattern Game::LoadPattern(tinyxml2::XMLElement *element)
+    {
+        BulletPattern pattern;
+
+        const char *kind = element->Attribute("pattern");
+        string kind_name = kind == nullptr ? "single" : kind;
+        if (kind_name == "spread")
+            pattern.kind = PatternKind::kSpread;
+        else if (kind_name == "radial")
+            pattern.kind = PatternKind::kRadial;
+        else if (kind_name == "spiral")
+            pattern.kind = PatternKind::kSpiral;
+        else
+            pattern.kind = PatternKind::kSingle;
+
+        // Angles are written in degrees in the level file.
+        pattern.count = element->IntAttribute("count", pattern.count);
+        pattern.speed = element->DoubleAttribute("speed", pattern.speed);
+        pattern.radius = element->DoubleAttribute("radius", pattern.radius);
+        pattern.spread = element->DoubleAttribute("spread", 0) * M_PI / 180;
+        pattern.spin = element->DoubleAttribute("spin", 0) * M_PI / 180;
+        pattern.interval = element->DoubleAttribute("interval", pattern.interval);
+
+        return pattern;
+    }
+
+    void Game::RenderEnemies()
+    {
+        // The enemy grid was refreshed by the last ProcessShoots, and dead enemies leave it.
+        shooting_system_.QueryVisibleEnemies(camera_, visible_enemies_);
+
+        for (auto &enemy : visible_enemies_)
+            static_cast<Character *>(enemy)->Render(renderer_);
+    }
+
+    void Game::UpdateHud(const RenderSnapshot &snapshot, double frame_time)
+    {
+        std::ostringstream frame_line;
+        frame_line << std::fixed << std::setprecision(1) << "FRAME " << frame_time << " MS";
+        std::ostringstream tick_line;
+        tick_line << std::fixed << std::setprecision(2) << "TICK " << snapshot.simulation_time << " MS";
+
+        hud_.set_line(0, frame_line.str());
+        hud_.set_line(1, tick_line.str());
+        hud_.set_line(2, "BODIES " + std::to_string(snapshot.body_count));
+        hud_.set_line(3, "BULLETS " + std::to_string(snapshot.bullet_count));
+        hud_.set_line(4, "PAIRS " + std::to_string(snapshot.pair_test_count));
+        hud_.set_line(5, "AI " + std::to_string(snapshot.agents_processed) + " OVERRUNS " + std::to_string(snapshot.budget_overruns));
+    }
+
+    void Game::ReportRenderStats(const RenderSnapshot &snapshot)
+    {
+        std::ostringstream title;
+        title << std::fixed << std::setprecision(1)
+              << "2D GAME - " << snapshot.draw_calls << " draw calls, " << snapshot.vertex_count << " vertices, "
+              << snapshot.visible_count << " visible, " << snapshot.culled_count << " culled, "
+              << "sim " << snapshot.simulation_time << " ms, render " << render_time_ << " ms, "
+              << frame_scheduler_.get_frame_rate() << " fps, jitter " << frame_scheduler_.get_jitter() << " ms, "
+              << "cpu " << frame_scheduler_.get_cpu_utilization() << "%, "
+              << skipped_frames_ << " frames skipped";
+
+        if (title.str() == reported_title_)
+            return;
+
+        reported_title_ = title.str();
+        glutSetWindowTitle(reported_title_.c_str());
+    }
+
+    void Game::AssignPatrolRoutes()
+    {
+        double support_tolerance = 1;
+        double patrol_radius = 30;
+
+        for (auto &enemy : enemies_)
+        {
+            Vector position = enemy->get_position();
+            double left = position[0];
+            double top = position[1];
+            double right = left + enemy->get_width();
+            double feet = top + enemy->get_height();
+            double center = (left + right) / 2;
+
+            Obstacle *support = nullptr;
+            double support_gap = support_tolerance;
+            for (auto &obstacle : map_.get_obstacles())
+            {
+                Vector obstacle_position = obstacle->get_position();
+                double gap = std::abs(obstacle_position[1] - feet);
+                if (obstacle_position[0] < right && obstacle_position[0] + obstacle->get_width() > left && gap <= support_gap)
+                {
+                    support = obstacle;
+                    support_gap = gap;
+                }
+            }
+
+            if (support == nullptr)
+            {
+                enemy_ai_scheduler_.AddAgent(enemy, left, right);
+                continue;
+            }
+
+            double patrol_left = max(support->get_position()[0], left - patrol_radius);
+            double patrol_right = min(support->get_position()[0] + support->get_width(), right + patrol_radius);
+
+            // Enemies do not collide, so walls standing on the platform bound the route instead.
+            for (auto &obstacle : map_.get_obstacles())
+            {
+                Vector obstacle_position = obstacle->get_position();
+                double obstacle_left = obstacle_position[0];
+                double obstacle_right = obstacle_left + obstacle->get_width();
+                bool blocking = obstacle_position[1] < feet - support_tolerance && obstacle_position[1] + obstacle->get_height() > top;
+
+                if (!blocking)
+                    continue;
+
+                if (obstacle_right <= center)
+                    patrol_left = max(patrol_left, obstacle_right);
+                else if (obstacle_left >= center)
+                    patrol_right = min(patrol_right, obstacle_left);
+            }
+
+            enemy_ai_scheduler_.AddAgent(enemy, patrol_left, patrol_right);
+        }
     }
 
     void Game::CheckKeys()
@@ -409,9 +866,7 @@ namespace shoot_and_jump
         if (mouse_[GLUT_LEFT_BUTTON] && !shoot_processed_)
         {
             shoot_processed_ = true;
-            Bullet *bullet = player_->Shoot();
-            bullets_.push_back(bullet);
-            shooting_system_.AddBullet(bullet);
+            player_->Shoot(bullet_system_, &particle_system_);
         }
     }
 #pragma endregion // Private Methods
@@ -1,17 +1,35 @@
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <thread>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <tuple>
 
 #include "../ext/tinyxml2.hpp"
 #include "../graphics/elements/map.hpp"
 #include "../graphics/elements/character/character.hpp"
-#include "../graphics/elements/bullet.hpp"
+#include "../graphics/elements/bullet_system.hpp"
+#include "../graphics/elements/bullet_emitter.hpp"
+#include "../graphics/elements/bullet_pattern.hpp"
+#include "../graphics/elements/particle_system.hpp"
 #include "../graphics/elements/shooting_system.hpp"
+#include "../graphics/rendering/batch_renderer.hpp"
+#include "../graphics/rendering/camera.hpp"
+#include "../graphics/rendering/hud.hpp"
+#include "../graphics/rendering/irender_backend.hpp"
 #include "../physics/collision_system.hpp"
 #include "../physics/gravity_constraint_system.hpp"
+#include "activity_scheduler.hpp"
+#include "debug_overlay.hpp"
+#include "dirty_tracker.hpp"
+#include "enemy_ai_scheduler.hpp"
+#include "frame_scheduler.hpp"
+#include "input_queue.hpp"
+#include "render_snapshot.hpp"
+#include "triple_buffer.hpp"
 
 namespace shoot_and_jump
 {
@@ -23,6 +41,10 @@ namespace shoot_and_jump
 
         void Update(double delta_time);
         void Run(int argc, char **argv);
+        // Steps the game in fixed ticks without a window and writes every frame,
+        // rasterized on the CPU, to <output_prefix><frame number>.ppm.
+        void RunHeadless(int frames, std::string output_prefix);
+        void StopSimulation();
 
         void Idle();
         void Display();
@@ -30,25 +52,57 @@ namespace shoot_and_jump
         void KeyReleased(unsigned char key, int x, int y);
         void BindMouseButton(int button, int state, int x, int y);
         void BindMouseMotion(int x, int y);
+        // GLUT reports no keyboard focus, so the pointer leaving the window counts as losing it.
+        void BindWindowEntry(int state);
+
+        // Shortest simulation step, in milliseconds.
+        inline static double min_tick_time_ = 1;
+        // Weight of the newest sample in the reported thread timings.
+        inline static double timing_smoothing_ = 0.05;
+        // Simulated milliseconds between two headless frames.
+        inline static double headless_frame_time_ = 1000.0 / 60;
+        inline static unsigned char hud_toggle_key_ = 'h';
+        inline static unsigned char debug_overlay_key_ = 'c';
 
     private:
         double delta_time_;
-        double current_time_;
+
+        // The simulation thread owns every game object below. The GLUT thread only
+        // touches the input queue, the read side of the snapshots and the backend.
+        std::thread simulation_thread_;
+        std::atomic<bool> simulating_ = false;
+        InputQueue input_queue_;
+        std::vector<InputEvent> input_events_;
+        TripleBuffer<RenderSnapshot> snapshots_;
+        unsigned long tick_ = 0;
+        double simulation_time_ = 0;
+        double render_time_ = 0;
+        FrameScheduler frame_scheduler_;
+        DirtyTracker dirty_tracker_;
+        int bullet_count_ = 0;
+        int particle_count_ = 0;
+        unsigned long skipped_frames_ = 0;
 
         graphics::elements::Map map_;
         graphics::elements::character::Character *player_;
         std::vector<graphics::elements::character::Character *> enemies_;
-        std::vector<graphics::elements::Bullet *> bullets_;
+        std::unordered_map<graphics::elements::character::Character *, size_t> enemy_indices_;
+        graphics::elements::BulletSystem bullet_system_;
+        graphics::elements::ParticleSystem particle_system_;
+        std::vector<graphics::elements::BulletEmitter *> emitters_;
+        graphics::rendering::IRenderBackend *render_backend_;
+        graphics::rendering::BatchRenderer renderer_;
+        graphics::rendering::Camera camera_;
+        // Owned by the GLUT thread, like the backend.
+        graphics::rendering::Hud hud_;
+        std::vector<physic::ICollidable *> visible_enemies_;
+        std::string reported_title_;
 
         std::map<char, bool> keys_;
         std::map<int, bool> mouse_;
         std::tuple<int, int> mouse_position_;
         bool shoot_processed_ = false;
 
-        double ortho_left_;
-        double ortho_right_;
-        double ortho_bottom_;
-        double ortho_top_;
         double ortho_near_;
         double ortho_far_;
 
@@ -58,6 +112,9 @@ namespace shoot_and_jump
         physic::CollisionSystem collision_system_;
         physic::GravityConstraintSystem gravity_constraint_system_;
         graphics::elements::ShootingSystem shooting_system_;
+        ActivityScheduler activity_scheduler_;
+        EnemyAIScheduler enemy_ai_scheduler_;
+        DebugOverlay debug_overlay_;
 
         void Allocate();
         void Deallocate();
@@ -67,8 +124,25 @@ namespace shoot_and_jump
         void LoadObstacle(tinyxml2::XMLElement *obstacle);
         void LoadPlayer(tinyxml2::XMLElement *player);
         void LoadEnemy(tinyxml2::XMLElement *enemy);
+        void LoadEmitter(tinyxml2::XMLElement *emitter);
+        graphics::elements::BulletPattern LoadPattern(tinyxml2::XMLElement *element);
+        void AssignPatrolRoutes();
+
+        void Simulate();
+        void Step();
+        void ApplyInput();
+        void TrackChanges();
+        void ToggleDebugOverlay();
+        void PublishSnapshot(double simulation_time);
+        void ReplaySnapshot(graphics::rendering::IRenderBackend &backend, const RenderSnapshot &snapshot);
 
         void CheckKeys();
         void ProcessAiming();
+        void UpdateEnemies();
+        void RemoveEnemy(graphics::elements::character::Character *enemy);
+        void ApplyHitEvents();
+        void RenderEnemies();
+        void ReportRenderStats(const RenderSnapshot &snapshot);
+        void UpdateHud(const RenderSnapshot &snapshot, double frame_time);
     };
 }
\ No newline at end of file
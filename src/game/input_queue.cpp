@@ -0,0 +1,26 @@
+#include "input_queue.hpp"
+
+#include <mutex>
+#include <vector>
+
+using ::shoot_and_jump::InputEvent;
+using ::shoot_and_jump::InputQueue;
+using ::std::lock_guard;
+using ::std::mutex;
+using ::std::vector;
+
+#pragma region Public Methods
+void InputQueue::Push(const InputEvent &event)
+{
+    lock_guard<mutex> lock(mutex_);
+    events_.push_back(event);
+}
+
+void InputQueue::Drain(vector<InputEvent> &events)
+{
+    events.clear();
+
+    lock_guard<mutex> lock(mutex_);
+    events.swap(events_);
+}
+#pragma endregion // Public Methods
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+namespace shoot_and_jump
+{
+    enum class InputEventType
+    {
+        kKeyPressed,
+        kKeyReleased,
+        kMouseButton,
+        kMouseMotion
+    };
+
+    struct InputEvent
+    {
+        InputEventType type;
+        int code;
+        int state;
+        int x;
+        int y;
+    };
+
+    // Carries window events from the GLUT thread to the simulation thread. Events are
+    // handed over in bulk, so the lock is held only for a push or a swap.
+    class InputQueue
+    {
+    public:
+        void Push(const InputEvent &event);
+        // Replaces the contents of events with everything pushed since the last drain.
+        void Drain(std::vector<InputEvent> &events);
+
+    private:
+        std::mutex mutex_;
+        std::vector<InputEvent> events_;
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "../graphics/rendering/recording_render_backend.hpp"
+
+namespace shoot_and_jump
+{
+    // Everything Display needs from one simulation tick. The simulation thread records the
+    // frame's draws into it; the render thread only replays them.
+    struct RenderSnapshot
+    {
+        unsigned long tick = 0;
+
+        double view_left = 0;
+        double view_right = 0;
+        double view_top = 0;
+        double view_bottom = 0;
+
+        graphics::rendering::RecordingRenderBackend commands;
+        int draw_calls = 0;
+        int vertex_count = 0;
+        int visible_count = 0;
+        int culled_count = 0;
+        int body_count = 0;
+        int bullet_count = 0;
+        int pair_test_count = 0;
+        int agents_processed = 0;
+        unsigned long budget_overruns = 0;
+
+        double simulation_time = 0;
+    };
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+
+namespace shoot_and_jump
+{
+    // Single producer, single consumer hand-off without locks. The producer fills the back
+    // buffer and swaps it with the middle one; the consumer swaps the middle one into the
+    // front only when it holds something newer. Neither side ever waits for the other and
+    // the consumer always sees the most recent complete buffer.
+    template <typename T>
+    class TripleBuffer
+    {
+    public:
+        TripleBuffer() = default;
+        TripleBuffer(const TripleBuffer &other) = delete;
+
+        TripleBuffer &operator=(const TripleBuffer &other) = delete;
+
+        // Producer side.
+        T &get_write_buffer()
+        {
+            return buffers_[back_];
+        }
+
+        void Publish()
+        {
+            back_ = middle_.exchange(back_ | kFreshBit, std::memory_order_acq_rel) & kIndexMask;
+        }
+
+        // Consumer side. Returns whether the read buffer changed.
+        bool Acquire()
+        {
+            if (!(middle_.load(std::memory_order_relaxed) & kFreshBit))
+                return false;
+
+            front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndexMask;
+            return true;
+        }
+
+        const T &get_read_buffer() const
+        {
+            return buffers_[front_];
+        }
+
+    private:
+        static constexpr int kIndexMask = 3;
+        static constexpr int kFreshBit = 4;
+
+        T buffers_[3];
+        int back_ = 0;
+        std::atomic<int> middle_ = 1;
+        int front_ = 2;
+    };
+}
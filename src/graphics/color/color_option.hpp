@@ -1,3 +1,5 @@
+#pragma once
+
 namespace graphics::color
 {
     enum ColorOption
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "rgba.hpp"
+#include "color_option.hpp"
+
+namespace graphics::color::palette
+{
+    inline constexpr RGBA kBlack(0, 0, 0);
+    inline constexpr RGBA kBlue(0, 0, 255);
+    inline constexpr RGBA kRed(255, 0, 0);
+    inline constexpr RGBA kGreen(0, 255, 0);
+    inline constexpr RGBA kWhite(255, 255, 255);
+    inline constexpr RGBA kYellow(255, 220, 64);
+    inline constexpr RGBA kOrange(255, 140, 0);
+
+    constexpr RGBA get_color(ColorOption color)
+    {
+        switch (color)
+        {
+        case ColorOption::kBlue:
+            return palette::kBlue;
+        case ColorOption::kRed:
+            return palette::kRed;
+        case ColorOption::kGreen:
+            return palette::kGreen;
+        default:
+            return palette::kBlack;
+        }
+    }
+}
@@ -1,109 +1,71 @@
 #include "rgba.hpp"
 
-using namespace graphics::color;
-
-#pragma region Constructors and Destructors
-RGBA::RGBA()
-{
-    red_ = 0;
-    green_ = 0;
-    blue_ = 0;
-    alpha_ = 255;
-}
+#include <array>
+#include <cstdint>
+#include <cstring>
 
-RGBA::RGBA(unsigned int red, unsigned int green, unsigned int blue)
-{
-    red_ = red;
-    green_ = green;
-    blue_ = blue;
-    alpha_ = 255;
-}
+using namespace graphics::color;
 
-RGBA::RGBA(unsigned int red, unsigned int green, unsigned int blue, unsigned int alpha)
+static constexpr std::array<float, 256> BuildNormalizedTable()
 {
-    red_ = red;
-    green_ = green;
-    blue_ = blue;
-    alpha_ = alpha;
+    std::array<float, 256> table = {};
+    for (int i = 0; i < 256; i++)
+        table[i] = i / 255.0f;
+    return table;
 }
 
-RGBA::RGBA(const RGBA &other)
-{
-    red_ = other.red_;
-    green_ = other.green_;
-    blue_ = other.blue_;
-    alpha_ = other.alpha_;
-}
+static constexpr std::array<float, 256> kNormalizedChannels = BuildNormalizedTable();
 
-RGBA::RGBA(const RGBA &&other)
+#pragma region Getters and Setters
+float RGBA::get_normalized_red() const
 {
-    red_ = other.red_;
-    green_ = other.green_;
-    blue_ = other.blue_;
-    alpha_ = other.alpha_;
+    return kNormalizedChannels[channels_[0]];
 }
 
-#pragma endregion // Constructors and Destructors
-
-#pragma region Operators
-RGBA &RGBA::operator=(const RGBA &other)
+float RGBA::get_normalized_green() const
 {
-    red_ = other.red_;
-    green_ = other.green_;
-    blue_ = other.blue_;
-    alpha_ = other.alpha_;
-
-    return *this;
+    return kNormalizedChannels[channels_[1]];
 }
 
-RGBA &RGBA::operator=(const RGBA &&other)
+float RGBA::get_normalized_blue() const
 {
-    red_ = other.red_;
-    green_ = other.green_;
-    blue_ = other.blue_;
-    alpha_ = other.alpha_;
-
-    return *this;
+    return kNormalizedChannels[channels_[2]];
 }
-#pragma endregion // Operators
 
-#pragma region Getters and Setters
-unsigned int RGBA::get_red() const
+float RGBA::get_normalized_alpha() const
 {
-    return this->red_;
+    return kNormalizedChannels[channels_[3]];
 }
 
-unsigned int RGBA::get_green() const
-{
-    return this->green_;
-}
-unsigned int RGBA::get_blue() const
+const unsigned char *RGBA::get_channels() const
 {
-    return this->blue_;
+    return channels_;
 }
 
-unsigned int RGBA::get_alpha() const
+std::uint32_t RGBA::get_packed() const
 {
-    return this->alpha_;
+    std::uint32_t packed;
+    std::memcpy(&packed, channels_, sizeof(packed));
+    return packed;
 }
 
 void RGBA::set_red(unsigned int red)
 {
-    this->red_ = red;
+    channels_[0] = Clamp(red);
 }
 
 void RGBA::set_green(unsigned int green)
 {
-    this->green_ = green;
+    channels_[1] = Clamp(green);
 }
 
 void RGBA::set_blue(unsigned int blue)
 {
-    this->blue_ = blue;
+    channels_[2] = Clamp(blue);
 }
 
 void RGBA::set_alpha(unsigned int alpha)
 {
-    this->alpha_ = alpha;
+    channels_[3] = Clamp(alpha);
 }
-#pragma endregion // Getters and Setters
\ No newline at end of file
+#pragma endregion // Getters and Setters
@@ -1,23 +1,40 @@
 #pragma once
 
+#include <cstdint>
+
 namespace graphics::color
 {
+    // Four 8-bit channels packed in 32 bits, laid out red, green, blue, alpha in memory so
+    // renderers copy them straight into vertex data. Constexpr so palettes cost nothing.
     class RGBA
     {
     public:
-        RGBA();
-        RGBA(unsigned int red, unsigned int green, unsigned int blue);
-        RGBA(unsigned int red, unsigned int green, unsigned int blue, unsigned int alpha);
-        RGBA(const RGBA &other);
-        RGBA(const RGBA &&other);
+        constexpr RGBA()
+            : channels_{0, 0, 0, 255} {}
+        constexpr RGBA(unsigned int red, unsigned int green, unsigned int blue)
+            : RGBA(red, green, blue, 255) {}
+        constexpr RGBA(unsigned int red, unsigned int green, unsigned int blue, unsigned int alpha)
+            : channels_{Clamp(red), Clamp(green), Clamp(blue), Clamp(alpha)} {}
+
+        constexpr bool operator==(const RGBA &other) const
+        {
+            return channels_[0] == other.channels_[0] && channels_[1] == other.channels_[1] &&
+                   channels_[2] == other.channels_[2] && channels_[3] == other.channels_[3];
+        }
 
-        RGBA &operator=(const RGBA &other);
-        RGBA &operator=(const RGBA &&other);
+        constexpr unsigned int get_red() const { return channels_[0]; }
+        constexpr unsigned int get_green() const { return channels_[1]; }
+        constexpr unsigned int get_blue() const { return channels_[2]; }
+        constexpr unsigned int get_alpha() const { return channels_[3]; }
 
-        unsigned int get_red() const;
-        unsigned int get_green() const;
-        unsigned int get_blue() const;
-        unsigned int get_alpha() const;
+        // Channels in [0, 1], read from a table instead of dividing on every use.
+        float get_normalized_red() const;
+        float get_normalized_green() const;
+        float get_normalized_blue() const;
+        float get_normalized_alpha() const;
+
+        const unsigned char *get_channels() const;
+        std::uint32_t get_packed() const;
 
         void set_red(unsigned int red);
         void set_green(unsigned int green);
@@ -25,9 +42,11 @@ namespace graphics::color
         void set_alpha(unsigned int alpha);
 
     private:
-        unsigned int red_;
-        unsigned int green_;
-        unsigned int blue_;
-        unsigned int alpha_;
+        unsigned char channels_[4];
+
+        static constexpr unsigned char Clamp(unsigned int channel)
+        {
+            return static_cast<unsigned char>(channel > 255 ? 255 : channel);
+        }
     };
-}
\ No newline at end of file
+}
@@ -1,6 +1,9 @@
 #include "rgba_factory.hpp"
 
 #include <algorithm>
+#include <string>
+
+#include "palette.hpp"
 
 using ::graphics::color::ColorOption;
 using ::graphics::color::RGBA;
@@ -8,35 +11,30 @@ using ::graphics::color::RGBAFactory;
 
 RGBA RGBAFactory::get_color(ColorOption color)
 {
-    switch (color)
-    {
-    case kBlack:
-        return RGBA(0, 0, 0);
-    case kBlue:
-        return RGBA(0, 0, 255);
-    case kRed:
-        return RGBA(255, 0, 0);
-    case kGreen:
-        return RGBA(0, 255, 0);
-    default:
-        return RGBA(0, 0, 0);
-    }
+    return palette::get_color(color);
 }
 
-RGBA RGBAFactory::get_color(std::string str_color)
+RGBA RGBAFactory::get_color(const std::string &color)
 {
+    auto it = cache_.find(color);
+    if (it != cache_.end())
+        return it->second;
+
+    std::string str_color = color;
     str_color.erase(std::remove(str_color.begin(), str_color.end(), ' '), str_color.end());
     std::transform(str_color.begin(), str_color.end(), str_color.begin(), ::tolower);
 
-    ColorOption color = kBlack;
+    ColorOption option = kBlack;
     if (str_color == "black")
-        color = kBlack;
+        option = kBlack;
     else if (str_color == "blue")
-        color = kBlue;
+        option = kBlue;
     else if (str_color == "red")
-        color = kRed;
+        option = kRed;
     else if (str_color == "green")
-        color = kGreen;
+        option = kGreen;
 
-    return get_color(color);
+    RGBA rgba = get_color(option);
+    cache_.emplace(color, rgba);
+    return rgba;
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
 #include "rgba.hpp"
 #include "color_option.hpp"
@@ -11,6 +12,11 @@ namespace graphics::color
     {
     public:
         static RGBA get_color(ColorOption color);
-        static RGBA get_color(std::string color);
+        // Names are normalized once and remembered exactly as written, so a repeated name
+        // costs one lookup. Meant for level loading, which runs on a single thread.
+        static RGBA get_color(const std::string &color);
+
+    private:
+        inline static std::unordered_map<std::string, RGBA> cache_;
     };
-}
\ No newline at end of file
+}
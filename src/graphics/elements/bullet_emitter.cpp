@@ -0,0 +1,109 @@
+#include "bullet_emitter.hpp"
+
+#include <cmath>
+
+#include "bullet_pattern.hpp"
+#include "bullet_system.hpp"
+#include "../../physics/icollidable.hpp"
+
+using ::graphics::elements::BulletEmitter;
+using ::graphics::elements::BulletPattern;
+using ::graphics::elements::BulletSystem;
+using ::graphics::elements::PatternKind;
+using ::physic::ICollidable;
+
+#pragma region Constructors and Destructors
+BulletEmitter::BulletEmitter(const BulletPattern &pattern)
+    : BulletEmitter(pattern, 0, 0)
+{
+}
+
+BulletEmitter::BulletEmitter(const BulletPattern &pattern, double x, double y)
+{
+    pattern_ = pattern;
+    if (pattern_.count < 1 || pattern_.kind == PatternKind::kSingle)
+        pattern_.count = 1;
+
+    x_ = x;
+    y_ = y;
+    phase_ = 0;
+    timer_ = 0;
+
+    BuildOffsets();
+    velocity_x_.assign(pattern_.count, 0);
+    velocity_y_.assign(pattern_.count, 0);
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+int BulletEmitter::Emit(double x, double y, double base_angle, ICollidable *owner, BulletSystem &bullet_system)
+{
+    Evaluate(base_angle + phase_);
+    phase_ = std::fmod(phase_ + pattern_.spin, 2 * M_PI);
+
+    return bullet_system.SpawnBatch(pattern_.count, x, y, velocity_x_.data(), velocity_y_.data(), pattern_.radius, owner);
+}
+
+int BulletEmitter::Update(double delta_time, ICollidable *owner, BulletSystem &bullet_system)
+{
+    if (pattern_.interval <= 0)
+        return 0;
+
+    int spawned = 0;
+    timer_ += delta_time;
+    while (timer_ >= pattern_.interval)
+    {
+        timer_ -= pattern_.interval;
+        spawned += Emit(x_, y_, 0, owner, bullet_system);
+    }
+
+    return spawned;
+}
+
+const BulletPattern &BulletEmitter::get_pattern() const
+{
+    return pattern_;
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void BulletEmitter::BuildOffsets()
+{
+    int count = pattern_.count;
+    offset_cos_.assign(count, 1);
+    offset_sin_.assign(count, 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        double offset = 0;
+
+        if (pattern_.kind == PatternKind::kSpread && count > 1)
+            offset = -pattern_.spread / 2 + pattern_.spread * i / (count - 1);
+        else if (pattern_.kind == PatternKind::kRadial || pattern_.kind == PatternKind::kSpiral)
+            offset = 2 * M_PI * i / count;
+
+        offset_cos_[i] = std::cos(offset);
+        offset_sin_[i] = std::sin(offset);
+    }
+}
+
+void BulletEmitter::Evaluate(double base_angle)
+{
+    double base_cos = pattern_.speed * std::cos(base_angle);
+    double base_sin = pattern_.speed * std::sin(base_angle);
+
+    const double *__restrict__ offset_cos = offset_cos_.data();
+    const double *__restrict__ offset_sin = offset_sin_.data();
+    double *__restrict__ velocity_x = velocity_x_.data();
+    double *__restrict__ velocity_y = velocity_y_.data();
+    int count = pattern_.count;
+
+    // Rotating the precomputed offsets keeps trigonometry out of the per-bullet loop.
+#pragma GCC ivdep
+    for (int i = 0; i < count; i++)
+    {
+        velocity_x[i] = offset_cos[i] * base_cos - offset_sin[i] * base_sin;
+        velocity_y[i] = offset_sin[i] * base_cos + offset_cos[i] * base_sin;
+    }
+}
+#pragma endregion // Private Methods
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+#include "bullet_pattern.hpp"
+#include "bullet_system.hpp"
+#include "../../physics/icollidable.hpp"
+
+namespace graphics::elements
+{
+    // Evaluates a bullet pattern into preallocated velocity arrays and spawns the whole
+    // batch straight into the bullet system. Nothing is allocated after construction.
+    class BulletEmitter
+    {
+    public:
+        BulletEmitter(const BulletPattern &pattern);
+        BulletEmitter(const BulletPattern &pattern, double x, double y);
+
+        int Emit(double x, double y, double base_angle, physic::ICollidable *owner, BulletSystem &bullet_system);
+        // Fires from the emitter's own position every pattern interval.
+        int Update(double delta_time, physic::ICollidable *owner, BulletSystem &bullet_system);
+
+        const BulletPattern &get_pattern() const;
+
+    private:
+        BulletPattern pattern_;
+        double x_;
+        double y_;
+        double phase_;
+        double timer_;
+
+        std::vector<double> offset_cos_;
+        std::vector<double> offset_sin_;
+        std::vector<double> velocity_x_;
+        std::vector<double> velocity_y_;
+
+        void BuildOffsets();
+        void Evaluate(double base_angle);
+    };
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace graphics::elements
+{
+    struct BulletHandle
+    {
+        unsigned int index = 0;
+        unsigned int generation = 0;
+
+        bool IsNull() const { return generation == 0; }
+
+        bool operator==(const BulletHandle &other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const BulletHandle &other) const { return !(*this == other); }
+    };
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+namespace graphics::elements
+{
+    enum class PatternKind
+    {
+        kSingle,
+        kSpread,
+        kRadial,
+        kSpiral
+    };
+
+    struct BulletPattern
+    {
+        PatternKind kind = PatternKind::kSingle;
+        int count = 1;
+        double speed = 0.05;
+        double radius = 0.5;
+        // Fan width in radians for spread patterns.
+        double spread = 0;
+        // Rotation added after every emission, in radians.
+        double spin = 0;
+        // Milliseconds between emissions of a free-running emitter.
+        double interval = 500;
+    };
+}
@@ -0,0 +1,230 @@
+#include "bullet_system.hpp"
+
+#include <algorithm>
+
+#include "bullet_handle.hpp"
+#include "../color/rgba.hpp"
+#include "../color/palette.hpp"
+#include "../../physics/icollidable.hpp"
+
+namespace palette = ::graphics::color::palette;
+using ::graphics::elements::BulletHandle;
+using ::graphics::elements::BulletSystem;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::Camera;
+using ::physic::ICollidable;
+
+#pragma region Constructors and Destructors
+BulletSystem::BulletSystem(int capacity)
+{
+    capacity_ = capacity;
+    size_ = 0;
+
+    x_.assign(capacity_, 0);
+    y_.assign(capacity_, 0);
+    velocity_x_.assign(capacity_, 0);
+    velocity_y_.assign(capacity_, 0);
+    radius_.assign(capacity_, 0);
+    owner_.assign(capacity_, nullptr);
+
+    dense_to_slot_.assign(capacity_, 0);
+    slot_to_dense_.assign(capacity_, -1);
+    generations_.assign(capacity_, 1);
+
+    free_slots_.reserve(capacity_);
+    for (int i = capacity_ - 1; i >= 0; i--)
+        free_slots_.push_back(i);
+
+    color_ = palette::kRed;
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+BulletHandle BulletSystem::Spawn(double x, double y, double velocity_x, double velocity_y, double radius, ICollidable *owner)
+{
+    if (free_slots_.empty())
+        return BulletHandle();
+
+    unsigned int slot = free_slots_.back();
+    free_slots_.pop_back();
+
+    int index = size_++;
+    x_[index] = x;
+    y_[index] = y;
+    velocity_x_[index] = velocity_x;
+    velocity_y_[index] = velocity_y;
+    radius_[index] = radius;
+    owner_[index] = owner;
+
+    dense_to_slot_[index] = slot;
+    slot_to_dense_[slot] = index;
+
+    BulletHandle handle;
+    handle.index = slot;
+    handle.generation = generations_[slot];
+    return handle;
+}
+
+int BulletSystem::SpawnBatch(int count, double x, double y, const double *velocity_x, const double *velocity_y, double radius, ICollidable *owner)
+{
+    count = std::min(count, static_cast<int>(free_slots_.size()));
+    int first = size_;
+
+    double *__restrict__ xs = x_.data() + first;
+    double *__restrict__ ys = y_.data() + first;
+    double *__restrict__ velocity_xs = velocity_x_.data() + first;
+    double *__restrict__ velocity_ys = velocity_y_.data() + first;
+    double *__restrict__ radii = radius_.data() + first;
+
+#pragma GCC ivdep
+    for (int i = 0; i < count; i++)
+    {
+        xs[i] = x;
+        ys[i] = y;
+        velocity_xs[i] = velocity_x[i];
+        velocity_ys[i] = velocity_y[i];
+        radii[i] = radius;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int slot = free_slots_.back();
+        free_slots_.pop_back();
+
+        owner_[first + i] = owner;
+        dense_to_slot_[first + i] = slot;
+        slot_to_dense_[slot] = first + i;
+    }
+
+    size_ += count;
+    return count;
+}
+
+bool BulletSystem::Despawn(BulletHandle handle)
+{
+    if (!IsAlive(handle))
+        return false;
+
+    unsigned int slot = handle.index;
+    int index = slot_to_dense_[slot];
+    int last = --size_;
+
+    if (index != last)
+    {
+        x_[index] = x_[last];
+        y_[index] = y_[last];
+        velocity_x_[index] = velocity_x_[last];
+        velocity_y_[index] = velocity_y_[last];
+        radius_[index] = radius_[last];
+        owner_[index] = owner_[last];
+
+        dense_to_slot_[index] = dense_to_slot_[last];
+        slot_to_dense_[dense_to_slot_[index]] = index;
+    }
+    slot_to_dense_[slot] = -1;
+
+    // Skip generation 0 on wrap around so a default handle never becomes valid.
+    if (++generations_[slot] == 0)
+        generations_[slot] = 1;
+
+    free_slots_.push_back(slot);
+    return true;
+}
+
+bool BulletSystem::IsAlive(BulletHandle handle) const
+{
+    if (handle.IsNull() || handle.index >= static_cast<unsigned int>(capacity_))
+        return false;
+
+    return generations_[handle.index] == handle.generation && slot_to_dense_[handle.index] != -1;
+}
+
+void BulletSystem::Update(double delta_time)
+{
+    double *__restrict__ x = x_.data();
+    double *__restrict__ y = y_.data();
+    const double *__restrict__ velocity_x = velocity_x_.data();
+    const double *__restrict__ velocity_y = velocity_y_.data();
+    int size = size_;
+
+#pragma GCC ivdep
+    for (int i = 0; i < size; i++)
+    {
+        x[i] += velocity_x[i] * delta_time;
+        y[i] += velocity_y[i] * delta_time;
+    }
+}
+
+void BulletSystem::Render(BatchRenderer &renderer)
+{
+    for (int i = 0; i < size_; i++)
+        renderer.SubmitCircle(x_[i], y_[i], radius_[i], color_);
+}
+
+void BulletSystem::Render(BatchRenderer &renderer, Camera &camera)
+{
+    int visible = 0;
+
+    for (int i = 0; i < size_; i++)
+    {
+        double radius = radius_[i];
+        if (!camera.IsVisible(x_[i] - radius, y_[i] - radius, radius * 2, radius * 2))
+            continue;
+
+        renderer.SubmitCircle(x_[i], y_[i], radius, color_);
+        visible++;
+    }
+
+    camera.Count(visible, size_ - visible);
+}
+#pragma endregion // Public Methods
+
+#pragma region Getters
+int BulletSystem::get_size() const
+{
+    return size_;
+}
+
+int BulletSystem::get_capacity() const
+{
+    return capacity_;
+}
+
+BulletHandle BulletSystem::get_handle(int index) const
+{
+    BulletHandle handle;
+    handle.index = dense_to_slot_[index];
+    handle.generation = generations_[handle.index];
+    return handle;
+}
+
+double BulletSystem::get_x(int index) const
+{
+    return x_[index];
+}
+
+double BulletSystem::get_y(int index) const
+{
+    return y_[index];
+}
+
+double BulletSystem::get_velocity_x(int index) const
+{
+    return velocity_x_[index];
+}
+
+double BulletSystem::get_velocity_y(int index) const
+{
+    return velocity_y_[index];
+}
+
+double BulletSystem::get_radius(int index) const
+{
+    return radius_[index];
+}
+
+ICollidable *BulletSystem::get_owner(int index) const
+{
+    return owner_[index];
+}
+#pragma endregion // Getters
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+
+#include "bullet_handle.hpp"
+#include "../color/rgba.hpp"
+#include "../rendering/batch_renderer.hpp"
+#include "../rendering/camera.hpp"
+#include "../../physics/icollidable.hpp"
+
+namespace graphics::elements
+{
+    // Straight-line bullets stored as parallel arrays. Live bullets are kept densely packed
+    // in [0, size) so Update is a single streaming loop; handles go through a slot table.
+    class BulletSystem
+    {
+    public:
+        BulletSystem(int capacity = default_capacity_);
+        BulletSystem(const BulletSystem &other) = delete;
+        ~BulletSystem() = default;
+
+        BulletSystem &operator=(const BulletSystem &other) = delete;
+
+        BulletHandle Spawn(double x, double y, double velocity_x, double velocity_y, double radius, physic::ICollidable *owner);
+        // Spawns up to count bullets from one point; returns how many fit in the pool.
+        int SpawnBatch(int count, double x, double y, const double *velocity_x, const double *velocity_y, double radius, physic::ICollidable *owner);
+        bool Despawn(BulletHandle handle);
+        bool IsAlive(BulletHandle handle) const;
+
+        void Update(double delta_time);
+        void Render(graphics::rendering::BatchRenderer &renderer);
+        // Bullets move every tick, so a straight bounds test over the packed arrays is
+        // cheaper than keeping them in a spatial index.
+        void Render(graphics::rendering::BatchRenderer &renderer, graphics::rendering::Camera &camera);
+
+        int get_size() const;
+        int get_capacity() const;
+
+        BulletHandle get_handle(int index) const;
+        double get_x(int index) const;
+        double get_y(int index) const;
+        double get_velocity_x(int index) const;
+        double get_velocity_y(int index) const;
+        double get_radius(int index) const;
+        physic::ICollidable *get_owner(int index) const;
+
+        inline static int default_capacity_ = 16384;
+
+    private:
+        int capacity_;
+        int size_;
+
+        std::vector<double> x_;
+        std::vector<double> y_;
+        std::vector<double> velocity_x_;
+        std::vector<double> velocity_y_;
+        std::vector<double> radius_;
+        std::vector<physic::ICollidable *> owner_;
+
+        std::vector<unsigned int> dense_to_slot_;
+        std::vector<int> slot_to_dense_;
+        std::vector<unsigned int> generations_;
+        std::vector<unsigned int> free_slots_;
+
+        color::RGBA color_;
+    };
+}
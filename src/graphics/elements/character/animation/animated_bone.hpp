@@ -0,0 +1,31 @@
+#pragma once
+
+namespace graphics::elements::character
+{
+    // Animation roles rather than skeleton bones, so one clip drives either leg as the
+    // front one. Listed parents first.
+    enum class AnimatedBone
+    {
+        kHead,
+        kTorso,
+        kBackThig,
+        kBackCalf,
+        kFrontThig,
+        kFrontCalf,
+    };
+
+    inline constexpr int kAnimatedBoneCount = 6;
+
+    // The skeleton bones a clip can pose, in a fixed order. Listed parents first.
+    enum class RigBone
+    {
+        kHead,
+        kTorso,
+        kLeftThig,
+        kLeftCalf,
+        kRightThig,
+        kRightCalf,
+    };
+
+    inline constexpr int kRigBoneCount = 6;
+}
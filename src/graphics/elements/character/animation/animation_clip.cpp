@@ -0,0 +1,157 @@
+#include "animation_clip.hpp"
+
+#include "walk_phase.hpp"
+
+using ::graphics::elements::character::AnimatedBone;
+using ::graphics::elements::character::AnimationClip;
+using ::graphics::elements::character::AnimationCurve;
+using ::graphics::elements::character::WalkPhase;
+
+#pragma region Clips
+const AnimationClip &AnimationClip::Walk()
+{
+    static const AnimationClip clip = []
+    {
+        AnimationClip walk;
+
+        // Added in WalkPhase order so the enum doubles as the phase index.
+        double duration = walk_phase_duration_;
+        walk.AddPhase(duration, AnimationCurve::kEaseIn, WalkPhase::kAir);
+        walk.AddPhase(duration, AnimationCurve::kLinear, WalkPhase::kDown);
+        walk.AddPhase(duration, AnimationCurve::kLinear, WalkPhase::kPassing);
+        walk.AddPhase(duration, AnimationCurve::kLinear, WalkPhase::kUp, true);
+        walk.AddPhase(duration, AnimationCurve::kLinear, WalkPhase::kAir);
+        walk.AddPhase(duration, AnimationCurve::kLinear, WalkPhase::kContact);
+
+        walk.SetKey(WalkPhase::kStarting, AnimatedBone::kHead, 0.0, 0.15);
+        walk.SetKey(WalkPhase::kStarting, AnimatedBone::kBackThig, 0.0, 0.25);
+        walk.SetKey(WalkPhase::kStarting, AnimatedBone::kBackCalf, 0.0, 0.45);
+        walk.SetKey(WalkPhase::kStarting, AnimatedBone::kFrontThig, 0.0, -0.55);
+        walk.SetKey(WalkPhase::kStarting, AnimatedBone::kFrontCalf, 0.0, 0.25);
+
+        walk.SetKey(WalkPhase::kAir, AnimatedBone::kBackThig, 0.25, 0.45);
+        walk.SetKey(WalkPhase::kAir, AnimatedBone::kBackCalf, 0.45, 0.75);
+        walk.SetKey(WalkPhase::kAir, AnimatedBone::kFrontThig, -0.55, -0.65);
+        walk.SetKey(WalkPhase::kAir, AnimatedBone::kFrontCalf, 0.25, 0.1);
+
+        walk.SetKey(WalkPhase::kContact, AnimatedBone::kFrontCalf, 0.1, -0.65);
+        walk.SetKey(WalkPhase::kContact, AnimatedBone::kBackThig, 0.45, 0.55);
+        walk.SetKey(WalkPhase::kContact, AnimatedBone::kBackCalf, 0.75, 1.55);
+
+        walk.SetKey(WalkPhase::kDown, AnimatedBone::kFrontCalf, -0.65, 0.25);
+        walk.SetKey(WalkPhase::kDown, AnimatedBone::kBackCalf, 1.55, 1.85);
+
+        // The front calf keeps its angle while the thigh swings through.
+        walk.SetKey(WalkPhase::kPassing, AnimatedBone::kFrontThig, -0.65, -0.15);
+        walk.SetKey(WalkPhase::kPassing, AnimatedBone::kFrontCalf, 0.25, 0.25);
+        walk.SetKey(WalkPhase::kPassing, AnimatedBone::kBackThig, 0.55, -0.35);
+
+        walk.SetKey(WalkPhase::kUp, AnimatedBone::kFrontThig, -0.35, -0.55);
+        walk.SetKey(WalkPhase::kUp, AnimatedBone::kFrontCalf, 0.95, 0.25);
+        walk.SetKey(WalkPhase::kUp, AnimatedBone::kBackThig, -0.15, 0.25);
+        walk.SetKey(WalkPhase::kUp, AnimatedBone::kBackCalf, 0.25, 0.45);
+
+        return walk;
+    }();
+
+    return clip;
+}
+
+const AnimationClip &AnimationClip::Jump()
+{
+    static const AnimationClip clip = []
+    {
+        AnimationClip jump;
+
+        // Tucks both legs under the body and holds the pose until the apex.
+        int tuck = jump.AddPhase(jump_duration_, AnimationCurve::kEaseOut, -1);
+        jump.SetKey(tuck, AnimatedBone::kHead, 0.0, 0.1);
+        jump.SetKey(tuck, AnimatedBone::kFrontThig, 0.0, -0.9);
+        jump.SetKey(tuck, AnimatedBone::kFrontCalf, 0.0, 0.3);
+        jump.SetKey(tuck, AnimatedBone::kBackThig, 0.0, -0.3);
+        jump.SetKey(tuck, AnimatedBone::kBackCalf, 0.0, 1.1);
+
+        return jump;
+    }();
+
+    return clip;
+}
+
+const AnimationClip &AnimationClip::Fall()
+{
+    static const AnimationClip clip = []
+    {
+        AnimationClip fall;
+
+        // Stretches the legs apart ready for landing.
+        int spread = fall.AddPhase(fall_duration_, AnimationCurve::kEaseInOut, -1);
+        fall.SetKey(spread, AnimatedBone::kFrontThig, 0.0, -0.45);
+        fall.SetKey(spread, AnimatedBone::kFrontCalf, 0.0, -0.15);
+        fall.SetKey(spread, AnimatedBone::kBackThig, 0.0, 0.35);
+        fall.SetKey(spread, AnimatedBone::kBackCalf, 0.0, 0.65);
+
+        return fall;
+    }();
+
+    return clip;
+}
+#pragma endregion // Clips
+
+#pragma region Public Methods
+int AnimationClip::get_phase_count() const
+{
+    return phases_.size();
+}
+
+double AnimationClip::get_duration() const
+{
+    double duration = 0;
+    for (const auto &phase : phases_)
+        duration += phase.duration;
+
+    return duration;
+}
+
+const AnimationClip::Phase &AnimationClip::get_phase(int phase) const
+{
+    return phases_[phase];
+}
+
+bool AnimationClip::IsKeyed(int phase, AnimatedBone bone) const
+{
+    return phases_[phase].keyed_bones & (1u << static_cast<int>(bone));
+}
+
+AnimatedBone AnimationClip::get_parent(AnimatedBone bone)
+{
+    switch (bone)
+    {
+    case AnimatedBone::kTorso:
+        return AnimatedBone::kHead;
+    case AnimatedBone::kBackThig:
+    case AnimatedBone::kFrontThig:
+        return AnimatedBone::kTorso;
+    case AnimatedBone::kBackCalf:
+        return AnimatedBone::kBackThig;
+    case AnimatedBone::kFrontCalf:
+        return AnimatedBone::kFrontThig;
+    default:
+        return AnimatedBone::kHead;
+    }
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+int AnimationClip::AddPhase(double duration, AnimationCurve curve, int next, bool swaps_legs)
+{
+    Phase phase = {duration, curve, next, swaps_legs, 0, {}};
+    phases_.push_back(phase);
+    return phases_.size() - 1;
+}
+
+void AnimationClip::SetKey(int phase, AnimatedBone bone, double start, double end)
+{
+    phases_[phase].keys[static_cast<int>(bone)] = {start, end};
+    phases_[phase].keyed_bones |= 1u << static_cast<int>(bone);
+}
+#pragma endregion // Private Methods
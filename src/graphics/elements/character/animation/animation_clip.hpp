@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+
+#include "animated_bone.hpp"
+#include "animation_curve.hpp"
+
+namespace graphics::elements::character
+{
+    // Keys are angles accumulated along the bone chain, authored for a character looking
+    // right; mirroring is applied when the clip is played.
+    struct Keyframe
+    {
+        double start;
+        double end;
+    };
+
+    class AnimationClip
+    {
+    public:
+        struct Phase
+        {
+            // In milliseconds.
+            double duration;
+            AnimationCurve curve;
+            // Negative when the clip holds its last pose.
+            int next;
+            bool swaps_legs;
+            unsigned int keyed_bones;
+            Keyframe keys[kAnimatedBoneCount];
+        };
+
+        // Compiled once and shared by every character.
+        static const AnimationClip &Walk();
+        static const AnimationClip &Jump();
+        static const AnimationClip &Fall();
+
+        // Matches the old fixed-increment walk at one millisecond ticks: two steps into
+        // the pose and one to notice it was reached.
+        inline static double walk_phase_duration_ = 3;
+        inline static double jump_duration_ = 6;
+        inline static double fall_duration_ = 8;
+
+        int get_phase_count() const;
+        // Length of one pass through every phase, in milliseconds.
+        double get_duration() const;
+        const Phase &get_phase(int phase) const;
+        bool IsKeyed(int phase, AnimatedBone bone) const;
+
+        static AnimatedBone get_parent(AnimatedBone bone);
+
+    private:
+        std::vector<Phase> phases_;
+
+        int AddPhase(double duration, AnimationCurve curve, int next, bool swaps_legs = false);
+        void SetKey(int phase, AnimatedBone bone, double start, double end);
+    };
+}
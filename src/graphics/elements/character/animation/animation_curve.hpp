@@ -0,0 +1,13 @@
+#pragma once
+
+namespace graphics::elements::character
+{
+    // Maps a phase's elapsed fraction to how far its bones have moved.
+    enum class AnimationCurve
+    {
+        kLinear,
+        kEaseIn,
+        kEaseOut,
+        kEaseInOut,
+    };
+}
@@ -0,0 +1,54 @@
+#include "animation_system.hpp"
+
+#include "../character.hpp"
+#include "../skeleton.hpp"
+
+using ::graphics::elements::character::AnimationSystem;
+using ::graphics::elements::character::Character;
+using ::graphics::elements::character::PoseCache;
+using ::graphics::elements::character::RigBone;
+using ::graphics::elements::character::Skeleton;
+
+AnimationSystem::AnimationSystem(Character *character, const PoseCache &cache)
+    : cache_(&cache), mirrored_(!character->looking_right_)
+{
+    set_character(character);
+}
+
+AnimationSystem::AnimationSystem(Skeleton *skeleton, const int (&bones)[kRigBoneCount], bool mirrored, const PoseCache &cache)
+    : skeleton_(skeleton), cache_(&cache), mirrored_(mirrored)
+{
+    for (int i = 0; i < kRigBoneCount; i++)
+        bones_[i] = bones[i];
+}
+
+void AnimationSystem::Animate(double delta_time)
+{
+    if (cache_ == nullptr)
+        return;
+
+    clip_time_ += delta_time;
+
+    int frame = cache_->get_frame_index(clip_time_);
+    if (frame == frame_)
+        return;
+    frame_ = frame;
+
+    const PoseCache::Frame &pose = cache_->get_frame(frame);
+    double sign = mirrored_ ? -1 : 1;
+
+    for (int bone = 0; bone < kRigBoneCount; bone++)
+        if (cache_->IsPosed(static_cast<RigBone>(bone)))
+            skeleton_->set_angle(bones_[bone], sign * pose.angles[bone]);
+}
+
+void AnimationSystem::set_character(Character *character)
+{
+    skeleton_ = &character->skeleton_;
+    bones_[static_cast<int>(RigBone::kHead)] = character->head_bone_;
+    bones_[static_cast<int>(RigBone::kTorso)] = character->torso_bone_;
+    bones_[static_cast<int>(RigBone::kLeftThig)] = character->left_thig_bone_;
+    bones_[static_cast<int>(RigBone::kLeftCalf)] = character->left_calf_bone_;
+    bones_[static_cast<int>(RigBone::kRightThig)] = character->right_thig_bone_;
+    bones_[static_cast<int>(RigBone::kRightCalf)] = character->right_calf_bone_;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "animated_bone.hpp"
+#include "pose_cache.hpp"
+
+namespace graphics::elements::character
+{
+    class Character;
+    class Skeleton;
+
+    // Plays a baked clip on one rig: advancing is a frame lookup, and only bones whose
+    // angle differs from the previous frame are touched.
+    class AnimationSystem
+    {
+    public:
+        AnimationSystem() = default;
+        AnimationSystem(Character *character, const PoseCache &cache);
+        // Bones are the skeleton ids in RigBone order.
+        AnimationSystem(Skeleton *skeleton, const int (&bones)[kRigBoneCount], bool mirrored, const PoseCache &cache);
+
+        // Advances the clip by delta_time milliseconds and poses the skeleton.
+        void Animate(double delta_time);
+
+        void set_character(Character *character);
+
+    private:
+        Skeleton *skeleton_ = nullptr;
+        int bones_[kRigBoneCount] = {};
+        const PoseCache *cache_ = nullptr;
+        double clip_time_ = 0;
+        int frame_ = -1;
+        bool mirrored_ = false;
+    };
+}
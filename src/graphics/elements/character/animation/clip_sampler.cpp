@@ -0,0 +1,157 @@
+#include "clip_sampler.hpp"
+
+#include <algorithm>
+
+using ::graphics::elements::character::AnimatedBone;
+using ::graphics::elements::character::AnimationClip;
+using ::graphics::elements::character::AnimationCurve;
+using ::graphics::elements::character::ClipSampler;
+using ::graphics::elements::character::RigBone;
+using ::std::min;
+
+ClipSampler::ClipSampler(const AnimationClip &clip)
+    : clip_(&clip), phase_(0), phase_time_(0), right_front_leg_(true), angles_(), posed_bones_(0)
+{
+    for (int index = 0; index < clip.get_phase_count(); index++)
+        for (int bone = 0; bone < kAnimatedBoneCount; bone++)
+            if (clip.IsKeyed(index, static_cast<AnimatedBone>(bone)))
+            {
+                posed_bones_ |= 1u << static_cast<int>(ResolveBone(static_cast<AnimatedBone>(bone), true));
+                posed_bones_ |= 1u << static_cast<int>(ResolveBone(static_cast<AnimatedBone>(bone), false));
+            }
+
+    Pose(clip.get_phase(phase_), 0);
+}
+
+#pragma region Public Methods
+void ClipSampler::Advance(double delta_time)
+{
+    if (phase_ < 0)
+        return;
+
+    phase_time_ += delta_time;
+
+    while (phase_ >= 0 && phase_time_ >= clip_->get_phase(phase_).duration)
+    {
+        const AnimationClip::Phase &ended = clip_->get_phase(phase_);
+        Pose(ended, 1);
+
+        phase_time_ -= ended.duration;
+        phase_ = ended.next;
+        if (ended.swaps_legs)
+            right_front_leg_ = !right_front_leg_;
+    }
+
+    if (phase_ >= 0)
+    {
+        const AnimationClip::Phase &current = clip_->get_phase(phase_);
+        Pose(current, phase_time_ / current.duration);
+    }
+}
+
+double ClipSampler::Ease(AnimationCurve curve, double progress)
+{
+    switch (curve)
+    {
+    case AnimationCurve::kEaseIn:
+        return progress * progress;
+    case AnimationCurve::kEaseOut:
+        return progress * (2 - progress);
+    case AnimationCurve::kEaseInOut:
+        return progress * progress * (3 - 2 * progress);
+    default:
+        return progress;
+    }
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void ClipSampler::Pose(const AnimationClip::Phase &phase, double progress)
+{
+    double weight = Ease(phase.curve, min(progress, 1.0));
+
+    // Keys are chain angles; parents are posed first, so each bone keeps what its
+    // ancestors leave over.
+    for (int bone = 0; bone < kAnimatedBoneCount; bone++)
+    {
+        if (!(phase.keyed_bones & (1u << bone)))
+            continue;
+
+        const Keyframe &key = phase.keys[bone];
+        double angle = key.start + (key.end - key.start) * weight;
+
+        RigBone rig_bone = ResolveBone(static_cast<AnimatedBone>(bone), right_front_leg_);
+        for (RigBone ancestor = rig_bone; ancestor != RigBone::kHead;)
+        {
+            ancestor = get_parent(ancestor);
+            angle -= angles_[static_cast<int>(ancestor)];
+        }
+
+        angles_[static_cast<int>(rig_bone)] = angle;
+    }
+}
+
+RigBone ClipSampler::ResolveBone(AnimatedBone bone, bool right_front_leg)
+{
+    switch (bone)
+    {
+    case AnimatedBone::kTorso:
+        return RigBone::kTorso;
+    case AnimatedBone::kBackThig:
+        return right_front_leg ? RigBone::kLeftThig : RigBone::kRightThig;
+    case AnimatedBone::kBackCalf:
+        return right_front_leg ? RigBone::kLeftCalf : RigBone::kRightCalf;
+    case AnimatedBone::kFrontThig:
+        return right_front_leg ? RigBone::kRightThig : RigBone::kLeftThig;
+    case AnimatedBone::kFrontCalf:
+        return right_front_leg ? RigBone::kRightCalf : RigBone::kLeftCalf;
+    default:
+        return RigBone::kHead;
+    }
+}
+
+RigBone ClipSampler::get_parent(RigBone bone)
+{
+    switch (bone)
+    {
+    case RigBone::kTorso:
+        return RigBone::kHead;
+    case RigBone::kLeftThig:
+    case RigBone::kRightThig:
+        return RigBone::kTorso;
+    case RigBone::kLeftCalf:
+        return RigBone::kLeftThig;
+    case RigBone::kRightCalf:
+        return RigBone::kRightThig;
+    default:
+        return RigBone::kHead;
+    }
+}
+#pragma endregion // Private Methods
+
+#pragma region Getters
+int ClipSampler::get_phase() const
+{
+    return phase_;
+}
+
+double ClipSampler::get_phase_time() const
+{
+    return phase_time_;
+}
+
+bool ClipSampler::IsRightFrontLeg() const
+{
+    return right_front_leg_;
+}
+
+double ClipSampler::get_angle(RigBone bone) const
+{
+    return angles_[static_cast<int>(bone)];
+}
+
+bool ClipSampler::IsPosed(RigBone bone) const
+{
+    return posed_bones_ & (1u << static_cast<int>(bone));
+}
+#pragma endregion // Getters
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "animated_bone.hpp"
+#include "animation_clip.hpp"
+
+namespace graphics::elements::character
+{
+    // Plays a clip by walking its phases as time passes and posing every rig bone relative
+    // to its parent. PoseCache bakes its frames with one, so a clip sampled live and the
+    // same clip baked agree on every frame.
+    class ClipSampler
+    {
+    public:
+        ClipSampler(const AnimationClip &clip);
+
+        void Advance(double delta_time);
+
+        // Negative once a clip that does not loop has ended.
+        int get_phase() const;
+        // Milliseconds spent in the current phase.
+        double get_phase_time() const;
+        bool IsRightFrontLeg() const;
+        double get_angle(RigBone bone) const;
+        // Rig bones the clip moves; the others are left as they are.
+        bool IsPosed(RigBone bone) const;
+
+        static double Ease(AnimationCurve curve, double progress);
+
+    private:
+        const AnimationClip *clip_;
+        int phase_;
+        double phase_time_;
+        bool right_front_leg_;
+        double angles_[kRigBoneCount];
+        unsigned int posed_bones_;
+
+        void Pose(const AnimationClip::Phase &phase, double progress);
+        static RigBone ResolveBone(AnimatedBone bone, bool right_front_leg);
+        static RigBone get_parent(RigBone bone);
+    };
+}
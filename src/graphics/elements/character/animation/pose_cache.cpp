@@ -0,0 +1,118 @@
+#include "pose_cache.hpp"
+
+#include <cmath>
+
+#include "clip_sampler.hpp"
+
+using ::graphics::elements::character::AnimationClip;
+using ::graphics::elements::character::ClipSampler;
+using ::graphics::elements::character::PoseCache;
+using ::graphics::elements::character::RigBone;
+using ::std::vector;
+
+PoseCache::PoseCache(const AnimationClip &clip, double frame_time)
+    : frame_time_(frame_time), loop_start_(-1), posed_bones_(0)
+{
+    Bake(clip);
+}
+
+#pragma region Caches
+const PoseCache &PoseCache::Walk()
+{
+    static const PoseCache cache(AnimationClip::Walk());
+    return cache;
+}
+
+const PoseCache &PoseCache::Jump()
+{
+    static const PoseCache cache(AnimationClip::Jump());
+    return cache;
+}
+
+const PoseCache &PoseCache::Fall()
+{
+    static const PoseCache cache(AnimationClip::Fall());
+    return cache;
+}
+#pragma endregion // Caches
+
+#pragma region Public Methods
+int PoseCache::get_frame_index(double time) const
+{
+    int index = std::floor(time / frame_time_);
+    int frame_count = frames_.size();
+
+    if (index < frame_count)
+        return index;
+
+    if (loop_start_ < 0)
+        return frame_count - 1;
+
+    return loop_start_ + (index - loop_start_) % (frame_count - loop_start_);
+}
+
+const PoseCache::Frame &PoseCache::get_frame(int index) const
+{
+    return frames_[index];
+}
+
+int PoseCache::get_frame_count() const
+{
+    return frames_.size();
+}
+
+double PoseCache::get_frame_time() const
+{
+    return frame_time_;
+}
+
+bool PoseCache::IsPosed(RigBone bone) const
+{
+    return posed_bones_ & (1u << static_cast<int>(bone));
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void PoseCache::Bake(const AnimationClip &clip)
+{
+    ClipSampler sampler(clip);
+
+    for (int bone = 0; bone < kRigBoneCount; bone++)
+        if (sampler.IsPosed(static_cast<RigBone>(bone)))
+            posed_bones_ |= 1u << bone;
+
+    // Phase entry times by front leg, to notice when the stride starts over.
+    vector<double> entries[2];
+    entries[0].assign(clip.get_phase_count(), -1);
+    entries[1].assign(clip.get_phase_count(), -1);
+    entries[sampler.IsRightFrontLeg()][sampler.get_phase()] = 0;
+
+    for (int i = 0;; i++)
+    {
+        int phase = sampler.get_phase();
+        bool right_front_leg = sampler.IsRightFrontLeg();
+
+        if (i > 0)
+            sampler.Advance(frame_time_);
+
+        if (sampler.get_phase() >= 0 && (sampler.get_phase() != phase || sampler.IsRightFrontLeg() != right_front_leg))
+        {
+            double &entry = entries[sampler.IsRightFrontLeg()][sampler.get_phase()];
+            if (entry >= 0)
+            {
+                loop_start_ = std::lround(entry / frame_time_);
+                return;
+            }
+            entry = i * frame_time_ - sampler.get_phase_time();
+        }
+
+        Frame frame;
+        for (int bone = 0; bone < kRigBoneCount; bone++)
+            frame.angles[bone] = sampler.get_angle(static_cast<RigBone>(bone));
+        frames_.push_back(frame);
+
+        if (sampler.get_phase() < 0)
+            return;
+    }
+}
+#pragma endregion // Private Methods
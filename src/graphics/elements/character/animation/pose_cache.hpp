@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+#include "animated_bone.hpp"
+#include "animation_clip.hpp"
+
+namespace graphics::elements::character
+{
+    // A clip sampled once at a fixed frame time into the angle of every rig bone relative
+    // to its parent. Angles do not depend on body proportions, so one cache serves every
+    // character. Looping clips keep one full stride, until the same phase comes back with
+    // the same front leg; others hold their last frame.
+    class PoseCache
+    {
+    public:
+        struct Frame
+        {
+            double angles[kRigBoneCount];
+        };
+
+        PoseCache(const AnimationClip &clip, double frame_time = default_frame_time_);
+
+        static const PoseCache &Walk();
+        static const PoseCache &Jump();
+        static const PoseCache &Fall();
+
+        // Frame shown once time milliseconds have passed since the clip started.
+        int get_frame_index(double time) const;
+        const Frame &get_frame(int index) const;
+        int get_frame_count() const;
+        double get_frame_time() const;
+        // Rig bones the clip moves; the others are left as they are.
+        bool IsPosed(RigBone bone) const;
+
+        // Divides every clip phase, so frames land exactly on phase boundaries.
+        inline static double default_frame_time_ = 0.25;
+
+    private:
+        std::vector<Frame> frames_;
+        double frame_time_;
+        // First frame of the repeating stride, negative when the clip does not loop.
+        int loop_start_;
+        unsigned int posed_bones_;
+
+        void Bake(const AnimationClip &clip);
+    };
+}
@@ -15,6 +15,5 @@ namespace graphics::elements::character
         ~Arm() = default;
 
         math::Vector TorsoAnchorPoint() const;
-        void Mirror(math::Vector &mirror_point);
     };
 }
\ No newline at end of file
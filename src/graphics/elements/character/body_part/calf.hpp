@@ -15,6 +15,5 @@ namespace graphics::elements::character
         ~Calf() = default;
 
         math::Vector ThigAnchorPoint() const;
-        void Mirror(math::Vector &mirror_point);
     };
 }
\ No newline at end of file
@@ -14,9 +14,3 @@ Vector Head::TorsoAnchorPoint() const
     position[1] += radius_ * sin(angle_ + M_PI / 2);
     return position;
 }
-
-void Head::Mirror(math::Vector &mirror_point)
-{
-    Scale(mirror_point, -1, 1);
-    angle_ *= -1;
-}
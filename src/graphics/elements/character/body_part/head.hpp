@@ -15,6 +15,5 @@ namespace graphics::elements::character
         virtual ~Head() = default;
 
         math::Vector TorsoAnchorPoint() const;
-        void Mirror(math::Vector &mirror_point);
     };
 }
\ No newline at end of file
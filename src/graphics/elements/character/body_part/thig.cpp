@@ -29,10 +29,4 @@ Vector Thig::CalfAnchorPoint() const
     position[1] += radius * sin(angle_ + M_PI / 2);
 
     return position;
-}
-
-void Thig::Mirror(math::Vector &mirror_point)
-{
-    Scale(mirror_point, -1, 1);
-    angle_ *= -1;
 }
\ No newline at end of file
@@ -16,7 +16,5 @@ namespace graphics::elements::character
 
         math::Vector TorsoAnchorPoint() const;
         math::Vector CalfAnchorPoint() const;
-
-        void Mirror(math::Vector &mirror_point);
     };
 }
\ No newline at end of file
@@ -52,10 +52,4 @@ Vector Torso::RightArmAnchorPoint() const
 Vector Torso::RightThigAnchorPoint() const
 {
     return LeftThigAnchorPoint();
-}
-
-void Torso::Mirror(math::Vector &mirror_point)
-{
-    Scale(mirror_point, -1, 1);
-    angle_ *= -1;
 }
\ No newline at end of file
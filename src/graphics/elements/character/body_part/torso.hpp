@@ -19,7 +19,5 @@ namespace graphics::elements::character
         math::Vector LeftThigAnchorPoint() const;
         math::Vector RightArmAnchorPoint() const;
         math::Vector RightThigAnchorPoint() const;
-
-        void Mirror(math::Vector &mirror_point);
     };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <cmath>
+#include <variant>
 
 #include "./state/falling_state.hpp"
 #include "../../../physics/rigid_body.hpp"
@@ -9,14 +10,21 @@
 #include "../../shapes/rectangle.hpp"
 #include "../../color/rgba_factory.hpp"
 #include "../gun.hpp"
-#include "../bullet.hpp"
+#include "../bullet_system.hpp"
+#include "../bullet_pattern.hpp"
+#include "../bullet_emitter.hpp"
 
 using ::graphics::color::RGBA;
-using ::graphics::elements::Bullet;
+using ::graphics::elements::BulletEmitter;
+using ::graphics::elements::BulletPattern;
+using ::graphics::elements::BulletSystem;
 using ::graphics::elements::Gun;
 using ::graphics::elements::character::BaseState;
 using ::graphics::elements::character::Character;
 using ::graphics::elements::character::FallingState;
+using ::graphics::elements::character::Heading;
+using ::graphics::elements::character::StateId;
+using ::graphics::rendering::BatchRenderer;
 using ::graphics::shapes::Circle;
 using ::graphics::shapes::Rectangle;
 using ::math::Vector;
@@ -37,7 +45,6 @@ Character::Character(Vector &initial_position, double radius, RGBA &color, bool
 {
     collision_processable_ = collision_processable;
     position_ = initial_position;
-    shape_ = Circle(position_, radius, color);
 
     double time_jump_max = 1000;
     Vector gravity_acceleration = Vector::Zero(2);
@@ -47,8 +54,6 @@ Character::Character(Vector &initial_position, double radius, RGBA &color, bool
     initial_jump_velocity_ = gravity_acceleration * time_jump_max * -1;
 
     InstantiateCharacter(radius, color);
-    Vector gun_initial_position = torso_->get_center_position();
-    gun_ = new Gun(gun_initial_position, torso_->get_height(), head_->get_radius());
 
     Allocate();
 }
@@ -73,10 +78,6 @@ void Character::InstantiateCharacter(double radius, graphics::color::RGBA &color
     double leg_width_factor = 0.15;
     double arm_width_factor = 0.15;
 
-    // Rotate factors
-    double arm_rotate_factor = M_PI / 6;
-    double leg_rotate_factor = M_PI / 12;
-
     // Instantiate head
     double head_radius = radius * head_radius_factor;
     Vector head_position = position_;
@@ -132,15 +133,47 @@ void Character::InstantiateCharacter(double radius, graphics::color::RGBA &color
     right_calf_position[1] += right_thig_height;
     right_calf_ = new Calf(right_calf_position, right_calf_width, right_calf_height, color);
 
-    left_arm_->Rotate(left_arm_->TorsoAnchorPoint(), -0.80);
-    right_arm_->Rotate(right_arm_->TorsoAnchorPoint(), -0.20);
+    // Instantiate gun
+    Vector gun_position = torso_->get_center_position();
+    gun_ = new Gun(gun_position, torso_->get_height(), head_->get_radius());
+
+    // Build the skeleton from the rest pose joints
+    Vector head_joint = head_->get_center_position();
+    Vector torso_joint = torso_->HeadAnchorPoint();
+    Vector left_arm_joint = left_arm_->TorsoAnchorPoint();
+    Vector right_arm_joint = right_arm_->TorsoAnchorPoint();
+    Vector left_thig_joint = left_thig_->TorsoAnchorPoint();
+    Vector right_thig_joint = right_thig_->TorsoAnchorPoint();
+    Vector left_calf_joint = left_calf_->ThigAnchorPoint();
+    Vector right_calf_joint = right_calf_->ThigAnchorPoint();
+
+    head_bone_ = skeleton_.AddBone(-1, head_joint[0] - position_[0], head_joint[1] - position_[1]);
+    torso_bone_ = skeleton_.AddBone(head_bone_, torso_joint[0] - head_joint[0], torso_joint[1] - head_joint[1]);
+    left_arm_bone_ = skeleton_.AddBone(torso_bone_, left_arm_joint[0] - torso_joint[0], left_arm_joint[1] - torso_joint[1]);
+    right_arm_bone_ = skeleton_.AddBone(torso_bone_, right_arm_joint[0] - torso_joint[0], right_arm_joint[1] - torso_joint[1]);
+    left_thig_bone_ = skeleton_.AddBone(torso_bone_, left_thig_joint[0] - torso_joint[0], left_thig_joint[1] - torso_joint[1]);
+    right_thig_bone_ = skeleton_.AddBone(torso_bone_, right_thig_joint[0] - torso_joint[0], right_thig_joint[1] - torso_joint[1]);
+    left_calf_bone_ = skeleton_.AddBone(left_thig_bone_, left_calf_joint[0] - left_thig_joint[0], left_calf_joint[1] - left_thig_joint[1]);
+    right_calf_bone_ = skeleton_.AddBone(right_thig_bone_, right_calf_joint[0] - right_thig_joint[0], right_calf_joint[1] - right_thig_joint[1]);
+    gun_bone_ = skeleton_.AddBone(left_arm_bone_, 0, 0);
+
+    // Move every part's geometry into its bone space
+    head_->Translate(head_joint * -1);
+    torso_->Translate(torso_joint * -1);
+    left_arm_->Translate(left_arm_joint * -1);
+    right_arm_->Translate(right_arm_joint * -1);
+    left_thig_->Translate(left_thig_joint * -1);
+    right_thig_->Translate(right_thig_joint * -1);
+    left_calf_->Translate(left_calf_joint * -1);
+    right_calf_->Translate(right_calf_joint * -1);
+    gun_->Translate(left_arm_joint * -1);
+
+    skeleton_.set_position(position_[0], position_[1]);
+    ResetAnimation();
 
     // Set characters width and height
     width_ = body_width;
     height_ = radius * 2;
-
-    // outline_ = new Rectangle(get_position(), get_width(), get_height(), color::RGBAFactory::get_color("black"));
-    outline_ = new Circle(left_arm_->TorsoAnchorPoint(), 0.3, color::RGBAFactory::get_color("red"));
 }
 
 Character &Character::operator=(const Character &other)
@@ -148,10 +181,8 @@ Character &Character::operator=(const Character &other)
     if (this != &other)
     {
         position_ = other.position_;
-        shape_ = other.shape_;
         head_ = other.head_;
         torso_ = other.torso_;
-        outline_ = other.outline_;
         left_arm_ = other.left_arm_;
         left_thig_ = other.left_thig_;
         left_calf_ = other.left_calf_;
@@ -162,96 +193,97 @@ Character &Character::operator=(const Character &other)
         acceleration_ = other.acceleration_;
         last_position_ = other.last_position_;
         looking_right_ = other.looking_right_;
+        skeleton_ = other.skeleton_;
+        head_bone_ = other.head_bone_;
+        torso_bone_ = other.torso_bone_;
+        left_arm_bone_ = other.left_arm_bone_;
+        right_arm_bone_ = other.right_arm_bone_;
+        left_thig_bone_ = other.left_thig_bone_;
+        right_thig_bone_ = other.right_thig_bone_;
+        left_calf_bone_ = other.left_calf_bone_;
+        right_calf_bone_ = other.right_calf_bone_;
+        gun_bone_ = other.gun_bone_;
 
         Deallocate();
-        this->state_ = other.state_->Clone();
+        state_ = other.state_;
+        std::visit([this](auto &state) { state.set_character(this); }, state_);
     }
     return *this;
 }
 
-void Character::Render()
+void Character::Render(BatchRenderer &renderer)
 {
-    head_->Draw();
-    torso_->Draw();
+    head_->Draw(renderer, BoneTransform(head_bone_));
+    torso_->Draw(renderer, BoneTransform(torso_bone_));
 
     if (looking_right_)
     {
-        left_arm_->Draw();
-        gun_->Render();
-        right_arm_->Draw();
+        left_arm_->Draw(renderer, BoneTransform(left_arm_bone_));
+        gun_->Render(renderer, BoneTransform(gun_bone_));
+        right_arm_->Draw(renderer, BoneTransform(right_arm_bone_));
     }
     else
     {
-        right_arm_->Draw();
-        gun_->Render();
-        left_arm_->Draw();
+        right_arm_->Draw(renderer, BoneTransform(right_arm_bone_));
+        gun_->Render(renderer, BoneTransform(gun_bone_));
+        left_arm_->Draw(renderer, BoneTransform(left_arm_bone_));
     }
 
-    right_thig_->Draw();
-    right_calf_->Draw();
+    right_thig_->Draw(renderer, BoneTransform(right_thig_bone_));
+    right_calf_->Draw(renderer, BoneTransform(right_calf_bone_));
 
-    left_thig_->Draw();
-    left_calf_->Draw();
+    left_thig_->Draw(renderer, BoneTransform(left_thig_bone_));
+    left_calf_->Draw(renderer, BoneTransform(left_calf_bone_));
 }
 
 void Character::Jump(double delta_time)
 {
-    state_->Jump(delta_time);
+    std::visit([&](auto &state) { state.Jump(delta_time); }, state_);
 }
 
 void Character::Jump(double delta_time, physic::Direction direction)
 {
-    state_->Jump(delta_time, direction);
+    std::visit([&](auto &state) { state.Jump(delta_time, direction); }, state_);
 }
 
 void Character::Stop(double delta_time)
 {
-    state_->Stop(delta_time);
+    std::visit([&](auto &state) { state.Stop(delta_time); }, state_);
 }
 
 void Character::Move(double delta_time, Direction direction)
 {
-    state_->Move(delta_time, direction);
+    std::visit([&](auto &state) { state.Move(delta_time, direction); }, state_);
 }
 
-void Character::set_state(BaseState *state)
+StateId Character::get_state_id() const
 {
-    delete state_;
-    this->state_ = state;
+    return std::visit([](const auto &state) { return state.get_id(); }, state_);
 }
 
 void Character::Aim(double angle)
 {
-    if (looking_right_)
-    {
+    double increment = angle - skeleton_.get_angle(gun_bone_);
 
-        double increment = angle - gun_->get_angle();
-        Vector position = left_arm_->TorsoAnchorPoint();
-
-        left_arm_->Rotate(position, increment);
-        right_arm_->Rotate(position, increment);
-        gun_->Rotate(position, increment);
-    }
-    else
-    {
-        double increment = angle - gun_->get_angle();
-        Vector position = left_arm_->TorsoAnchorPoint();
+    skeleton_.Rotate(left_arm_bone_, increment);
+    skeleton_.Rotate(right_arm_bone_, increment);
+}
 
-        left_arm_->Rotate(position, increment);
-        right_arm_->Rotate(position, increment);
-        gun_->Rotate(position, increment);
-    }
+void Character::Face(Direction direction)
+{
+    if (direction == Direction::kRight && !looking_right_)
+        Mirror();
+    else if (direction == Direction::kLeft && looking_right_)
+        Mirror();
 }
 
 void Character::Allocate()
 {
-    graphics::shapes::Rectangle left_arm_;
-    state_ = new FallingState(this);
+    set_state<FallingState<Heading::kNeutral>>();
 }
 
 void Character::Deallocate()
 {
-    delete state_;
     delete head_;
     delete torso_;
     delete left_arm_;
@@ -261,7 +293,6 @@ void Character::Deallocate()
     delete left_calf_;
     delete right_calf_;
     delete gun_;
-    delete outline_;
 }
 
 Vector Character::get_position()
@@ -292,16 +323,13 @@ void Character::ProcessCollision(ICollidable *collidable)
 {
     if (collision_processable_)
     {
-        state_->ProcessCollision(collidable);
+        std::visit([collidable](auto &state) { state.ProcessCollision(collidable); }, state_);
     }
 }
 
 void Character::ProcessMove(double delta_time)
 {
-    Vector position = position_;
     Update(delta_time);
-    Vector translation = position_ - position;
-    Translate(translation, false);
 }
 
 void Character::ProcessCollisionByLeft(ICollidable *collidable)
@@ -334,103 +362,65 @@ void Character::ProcessCollisionByBottom(ICollidable *collidable)
 
 void Character::ProcessGravity()
 {
-    state_->ProcessGravity();
+    std::visit([](auto &state) { state.ProcessGravity(); }, state_);
 }
 
-void Character::Translate(double dx, double dy, bool translate_position)
+void Character::Translate(double dx, double dy)
 {
     Vector translation(2);
     translation[0] = dx;
     translation[1] = dy;
-    Translate(translation, translate_position);
+    Translate(translation);
 }
 
-void Character::Translate(math::Vector &translation, bool translate_position)
+void Character::Translate(math::Vector &translation)
 {
-    shape_.Translate(translation);
-    head_->Translate(translation);
-    torso_->Translate(translation);
-    outline_->Translate(translation);
-    left_arm_->Translate(translation);
-    right_arm_->Translate(translation);
-    left_thig_->Translate(translation);
-    right_thig_->Translate(translation);
-    left_calf_->Translate(translation);
-    right_calf_->Translate(translation);
+    position_ += translation;
+}
 
-    gun_->Translate(translation, translate_position);
+const math::AffineTransform &Character::BoneTransform(int bone)
+{
+    skeleton_.set_position(position_[0], position_[1]);
+    return skeleton_.get_world_transform(bone);
+}
 
-    if (translate_position)
-        position_ += translation;
+unsigned long Character::get_revision()
+{
+    skeleton_.set_position(position_[0], position_[1]);
+    return skeleton_.get_revision();
 }
 
 void Character::ResetAnimation()
 {
-    head_->Rotate(head_->get_center_position(), -head_->get_angle());
-
-    torso_->Rotate(torso_->get_center_position(), -torso_->get_angle());
-    Vector torso_translation = head_->TorsoAnchorPoint() - torso_->HeadAnchorPoint();
-    torso_->Translate(torso_translation);
-
-    right_arm_->Rotate(right_arm_->get_center_position(), -right_arm_->get_angle());
-    Vector right_arm_translation = torso_->RightArmAnchorPoint() - right_arm_->TorsoAnchorPoint();
-    right_arm_->Translate(right_arm_translation);
-
-    left_thig_->Rotate(left_thig_->get_center_position(), -left_thig_->get_angle());
-    Vector left_thig_translation = torso_->LeftThigAnchorPoint() - left_thig_->TorsoAnchorPoint();
-    left_thig_->Translate(left_thig_translation);
-
-    right_thig_->Rotate(right_thig_->get_center_position(), -right_thig_->get_angle());
-    Vector right_thig_translation = torso_->RightThigAnchorPoint() - right_thig_->TorsoAnchorPoint();
-    right_thig_->Translate(right_thig_translation);
-
-    left_calf_->Rotate(left_calf_->get_center_position(), -left_calf_->get_angle());
-    Vector left_calf_translation = left_thig_->CalfAnchorPoint() - left_calf_->ThigAnchorPoint();
-    left_calf_->Translate(left_calf_translation);
-
-    right_calf_->Rotate(right_calf_->get_center_position(), -right_calf_->get_angle());
-    Vector right_calf_translation = right_thig_->CalfAnchorPoint() - right_calf_->ThigAnchorPoint();
-    right_calf_->Translate(right_calf_translation);
-
-    left_arm_->Rotate(left_arm_->get_center_position(), -left_arm_->get_angle());
-    Vector left_arm_translation = torso_->LeftArmAnchorPoint() - left_arm_->TorsoAnchorPoint();
-    left_arm_->Translate(left_arm_translation);
-
-    gun_->Rotate(torso_->LeftArmAnchorPoint(), -gun_->get_angle());
+    skeleton_.ResetPose();
 
     if (looking_right_)
     {
-        left_arm_->Rotate(left_arm_->TorsoAnchorPoint(), -0.80);
-        right_arm_->Rotate(right_arm_->TorsoAnchorPoint(), -0.20);
+        skeleton_.Rotate(left_arm_bone_, -0.80);
+        skeleton_.Rotate(right_arm_bone_, -0.20);
     }
     else
     {
-        right_arm_->Rotate(right_arm_->TorsoAnchorPoint(), 0.80);
-        left_arm_->Rotate(left_arm_->TorsoAnchorPoint(), 0.20);
+        skeleton_.Rotate(right_arm_bone_, 0.80);
+        skeleton_.Rotate(left_arm_bone_, 0.20);
     }
+
+    // The gun hangs from the left arm but starts level
+    skeleton_.Rotate(gun_bone_, -skeleton_.get_angle(gun_bone_));
 }
 
 void Character::Mirror()
 {
-    Vector center = torso_->get_center_position();
-
-    outline_->Scale(center, -1, 1);
-    shape_.Scale(center, -1, 1);
-
-    head_->Mirror(center);
-    torso_->Mirror(center);
-    left_arm_->Mirror(center);
-    right_arm_->Mirror(center);
-    left_thig_->Mirror(center);
-    right_thig_->Mirror(center);
-    left_calf_->Mirror(center);
-    right_calf_->Mirror(center);
-    gun_->Mirror(center);
-
+    skeleton_.Mirror();
     looking_right_ = !looking_right_;
 }
 
-Bullet *Character::Shoot()
+int Character::Shoot(BulletSystem &bullet_system, ParticleSystem *particle_system)
+{
+    return gun_->Shoot(BoneTransform(gun_bone_), skeleton_.get_angle(gun_bone_), !looking_right_, bullet_system, this, particle_system);
+}
+
+void Character::set_fire_pattern(const BulletPattern &pattern)
 {
-    return gun_->Shoot(!looking_right_);
+    gun_->set_emitter(new BulletEmitter(pattern));
 }
\ No newline at end of file
@@ -8,23 +8,20 @@
 #include "../../color/rgba.hpp"
 #include "../../shapes/rectangle.hpp"
 #include "../../shapes/circle.hpp"
-#include "../bullet.hpp"
+#include "../../rendering/batch_renderer.hpp"
+#include "../bullet_system.hpp"
+#include "../particle_system.hpp"
+#include "../bullet_pattern.hpp"
 #include "./state/base_state.hpp"
-#include "./state/grounded_state.hpp"
-#include "./state/walking_left_state.hpp"
-#include "./state/walking_right_state.hpp"
-#include "./state/falling_state.hpp"
-#include "./state/falling_left_state.hpp"
-#include "./state/falling_right_state.hpp"
-#include "./state/jumping_state.hpp"
-#include "./state/jumping_right_state.hpp"
-#include "./state/jumping_left_state.hpp"
+#include "./state/state_id.hpp"
+#include "./state/character_state.hpp"
 #include "./body_part/head.hpp"
 #include "./body_part/torso.hpp"
 #include "./body_part/arm.hpp"
 #include "./body_part/thig.hpp"
 #include "./body_part/calf.hpp"
-#include "./animation/walking_animation_system.hpp"
+#include "./animation/animation_system.hpp"
+#include "./skeleton.hpp"
 
 namespace graphics::elements
 {
@@ -42,7 +39,7 @@ namespace graphics::elements
 
             Character &operator=(const Character &other);
 
-            void Render();
+            void Render(graphics::rendering::BatchRenderer &renderer);
 
             void Jump(double delta_time);
             void Jump(double delta_time, physic::Direction direction);
@@ -50,9 +47,18 @@ namespace graphics::elements
             void Move(double delta_time, physic::Direction direction);
 
             void Aim(double angle);
-            Bullet* Shoot();
-
-            void set_state(BaseState *state);
+            // Turns a standing character around; walking states keep their own facing.
+            void Face(physic::Direction direction);
+            int Shoot(BulletSystem &bullet_system, ParticleSystem *particle_system = nullptr);
+            void set_fire_pattern(const BulletPattern &pattern);
+
+            // The calling state is destroyed in place, so it must return right after.
+            template <typename State>
+            void set_state()
+            {
+                state_.template emplace<State>(this);
+            }
+            StateId get_state_id() const;
 
             math::Vector get_position() override;
             double get_width() override;
@@ -61,13 +67,12 @@ namespace graphics::elements
             void ProcessGravity() override;
 
             bool IsLookingRight();
+            // Changes whenever the character would be drawn differently.
+            unsigned long get_revision();
 
             inline static double default_horizontal_velocity_ = 0.05;
 
         private:
-            graphics::shapes::Circle shape_;
-
-            graphics::shapes::Model2D *outline_;
             Head *head_;
             Torso *torso_;
             Arm *left_arm_;
@@ -79,10 +84,22 @@ namespace graphics::elements
 
             Gun *gun_;
 
+            // Parts keep their geometry in bone space; the skeleton places them at draw time.
+            Skeleton skeleton_;
+            int head_bone_;
+            int torso_bone_;
+            int left_arm_bone_;
+            int right_arm_bone_;
+            int left_thig_bone_;
+            int right_thig_bone_;
+            int left_calf_bone_;
+            int right_calf_bone_;
+            int gun_bone_;
+
             double width_;
             double height_;
 
-            BaseState *state_;
+            CharacterState state_;
             bool looking_right_ = true;
             math::Vector initial_jump_velocity_;
             bool collision_processable_;
@@ -93,8 +110,9 @@ namespace graphics::elements
             void ProcessCollisionByTop(physic::ICollidable *collidable);
             void ProcessCollisionByBottom(physic::ICollidable *collidable);
 
-            void Translate(double dx, double dy, bool translate_position = true);
-            void Translate(math::Vector &translation, bool translate_position = true);
+            void Translate(double dx, double dy);
+            void Translate(math::Vector &translation);
+            const math::AffineTransform &BoneTransform(int bone);
 
             void Allocate();
             void Deallocate();
@@ -104,16 +122,15 @@ namespace graphics::elements
             void ResetAnimation();
             void Mirror();
 
-            friend class FallingState;
-            friend class FallingLeftState;
-            friend class FallingRightState;
+            friend class BaseState;
             friend class GroundedState;
+            template <Heading heading>
+            friend class WalkingState;
+            template <Heading heading>
             friend class JumpingState;
-            friend class JumpingLeftState;
-            friend class JumpingRightState;
-            friend class WalkingLeftState;
-            friend class WalkingRightState;
-            friend class WalkingAnimationSystem;
+            template <Heading heading>
+            friend class FallingState;
+            friend class AnimationSystem;
         };
 
     }
@@ -0,0 +1,123 @@
+#include "skeleton.hpp"
+
+#include "../../../math/affine_transform.hpp"
+
+using ::graphics::elements::character::Skeleton;
+using ::math::AffineTransform;
+
+#pragma region Constructors and Destructors
+Skeleton::Skeleton()
+{
+    x_ = 0;
+    y_ = 0;
+    mirrored_ = false;
+    dirty_ = true;
+    revision_ = 0;
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+int Skeleton::AddBone(int parent, double joint_x, double joint_y)
+{
+    bones_.push_back({parent, joint_x, joint_y, 0, AffineTransform()});
+    dirty_ = true;
+    return bones_.size() - 1;
+}
+
+void Skeleton::Mirror()
+{
+    mirrored_ = !mirrored_;
+    dirty_ = true;
+}
+
+void Skeleton::Rotate(int bone, double radians)
+{
+    bones_[bone].angle += mirrored_ ? -radians : radians;
+    dirty_ = true;
+}
+
+void Skeleton::ResetPose()
+{
+    for (auto &bone : bones_)
+        bone.angle = 0;
+    dirty_ = true;
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void Skeleton::UpdateWorldTransforms()
+{
+    AffineTransform root = AffineTransform::Translation(x_, y_) * AffineTransform::Scale(mirrored_ ? -1 : 1, 1);
+
+    bool changed = false;
+    for (auto &bone : bones_)
+    {
+        const AffineTransform &parent = bone.parent == -1 ? root : bones_[bone.parent].world;
+        AffineTransform world = parent * AffineTransform::Translation(bone.joint_x, bone.joint_y) * AffineTransform::Rotation(bone.angle);
+
+        changed = changed || world != bone.world;
+        bone.world = world;
+    }
+
+    if (changed)
+        revision_++;
+    dirty_ = false;
+}
+#pragma endregion // Private Methods
+
+#pragma region Getters and Setters
+void Skeleton::set_position(double x, double y)
+{
+    if (x == x_ && y == y_)
+        return;
+
+    x_ = x;
+    y_ = y;
+    dirty_ = true;
+}
+
+bool Skeleton::IsMirrored() const
+{
+    return mirrored_;
+}
+
+void Skeleton::set_angle(int bone, double radians)
+{
+    double angle = mirrored_ ? -radians : radians;
+    if (bones_[bone].angle == angle)
+        return;
+
+    bones_[bone].angle = angle;
+    dirty_ = true;
+}
+
+double Skeleton::get_angle(int bone) const
+{
+    double angle = 0;
+    for (int i = bone; i != -1; i = bones_[i].parent)
+        angle += bones_[i].angle;
+
+    return mirrored_ ? -angle : angle;
+}
+
+const AffineTransform &Skeleton::get_world_transform(int bone)
+{
+    if (dirty_)
+        UpdateWorldTransforms();
+
+    return bones_[bone].world;
+}
+
+int Skeleton::get_bone_count() const
+{
+    return bones_.size();
+}
+
+unsigned long Skeleton::get_revision()
+{
+    if (dirty_)
+        UpdateWorldTransforms();
+
+    return revision_;
+}
+#pragma endregion // Getters and Setters
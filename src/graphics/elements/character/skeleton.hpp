@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+
+#include "../../../math/affine_transform.hpp"
+
+namespace graphics::elements::character
+{
+    // Bones hang from their parent's joint and rotate about their own joint. Geometry
+    // attached to a bone stays in bone space; world transforms are composed lazily, once
+    // per change, so moving or mirroring the whole rig is O(1).
+    //
+    // Angles are in the facing frame: rotating by a positive angle looks the same on
+    // screen whether or not the rig is mirrored, matching how body parts used to behave.
+    class Skeleton
+    {
+    public:
+        Skeleton();
+
+        // Bones must be added after their parent. The joint is relative to the parent's joint.
+        int AddBone(int parent, double joint_x, double joint_y);
+
+        void set_position(double x, double y);
+        void Mirror();
+        bool IsMirrored() const;
+
+        void Rotate(int bone, double radians);
+        // Sets the angle relative to the parent; leaves the pose clean when nothing changes.
+        void set_angle(int bone, double radians);
+        void ResetPose();
+        double get_angle(int bone) const;
+
+        const math::AffineTransform &get_world_transform(int bone);
+        int get_bone_count() const;
+        // Advances only when a world transform actually changed, so undoing a pose within
+        // one tick does not count as a change.
+        unsigned long get_revision();
+
+    private:
+        struct Bone
+        {
+            int parent;
+            double joint_x;
+            double joint_y;
+            double angle;
+            math::AffineTransform world;
+        };
+
+        std::vector<Bone> bones_;
+        double x_;
+        double y_;
+        bool mirrored_;
+        bool dirty_;
+        unsigned long revision_;
+
+        void UpdateWorldTransforms();
+    };
+}
@@ -1,14 +1,45 @@
 #include "base_state.hpp"
 
+#include "../character.hpp"
+
 using ::graphics::elements::character::BaseState;
-using ::std::string;
+using ::graphics::elements::character::Character;
+using ::graphics::elements::character::Heading;
+using ::physic::ICollidable;
+
+void BaseState::set_character(Character *character)
+{
+    character_ = character;
+}
 
-string BaseState::get_name() const
+void BaseState::ResetForces(bool supported)
 {
-    return name_;
+    for (int i = 0; i < character_->acceleration_.get_dimension(); i++)
+    {
+        character_->acceleration_[i] = 0;
+        character_->external_force_[i] = supported ? character_->weight_[i] * -1 : 0;
+    }
 }
 
-std::string BaseState::to_string() const
+void BaseState::set_horizontal_velocity(Heading heading)
 {
-    return "State: " + name_;
-}
\ No newline at end of file
+    if (heading == Heading::kLeft)
+        character_->velocity_[0] = -Character::default_horizontal_velocity_;
+    else if (heading == Heading::kRight)
+        character_->velocity_[0] = Character::default_horizontal_velocity_;
+    else
+        character_->velocity_[0] = 0;
+}
+
+void BaseState::ProcessCollisionBySide(Heading heading, ICollidable *collidable)
+{
+    if (heading == Heading::kLeft)
+        character_->ProcessCollisionByLeft(collidable);
+    else
+        character_->ProcessCollisionByRight(collidable);
+}
+
+double BaseState::get_probe_width(Heading heading) const
+{
+    return heading == Heading::kLeft ? character_->get_width() : 0;
+}
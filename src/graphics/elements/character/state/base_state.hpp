@@ -1,40 +1,33 @@
 #pragma once
 
-#include <string>
-
-#include "../../../../physics/direction.hpp"
+#include "heading.hpp"
+#include "state_id.hpp"
 #include "../../../../physics/icollidable.hpp"
 
 namespace graphics::elements::character
 {
     class Character;
 
+    // Shared data and helpers for the states stored in place inside a character. States
+    // are dispatched statically, so there are no virtual methods here.
     class BaseState
     {
     public:
-        BaseState();
-        BaseState(BaseState &state)
-            : character_(state.character_), direction_(state.direction_){};
+        BaseState() = default;
         BaseState(Character *character)
             : character_(character) {}
-        virtual ~BaseState() {}
-
-        std::string get_name() const;
-
-        virtual void Jump(double delta_time){};
-        virtual void Jump(double delta_time, physic::Direction direction){};
-        virtual void Stop(double delta_time){};
-        virtual void Move(double delta_time, physic::Direction direction){};
-        virtual void ProcessCollision(physic::ICollidable *collidable){};
-        virtual void ProcessGravity(){};
-
-        virtual BaseState *Clone() = 0;
 
-        virtual std::string to_string() const;
+        void set_character(Character *character);
 
     protected:
-        Character *character_;
-        physic::Direction direction_ = physic::Direction::kRight;
-        std::string name_ = "Unnamed";
+        Character *character_ = nullptr;
+
+        // Zeroes acceleration and, when supported by the ground, cancels the weight.
+        void ResetForces(bool supported);
+        void set_horizontal_velocity(Heading heading);
+        void ProcessCollisionBySide(Heading heading, physic::ICollidable *collidable);
+        // Width of the box probed from the last position to tell a ceiling or floor hit
+        // from a wall hit.
+        double get_probe_width(Heading heading) const;
     };
-}
\ No newline at end of file
+}
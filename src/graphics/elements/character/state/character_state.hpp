@@ -0,0 +1,24 @@
+#pragma once
+
+#include <variant>
+
+#include "heading.hpp"
+#include "grounded_state.hpp"
+#include "walking_state.hpp"
+#include "jumping_state.hpp"
+#include "falling_state.hpp"
+
+namespace graphics::elements::character
+{
+    // Every state a character can be in, stored in place so a transition allocates nothing.
+    using CharacterState = std::variant<
+        GroundedState,
+        WalkingState<Heading::kLeft>,
+        WalkingState<Heading::kRight>,
+        JumpingState<Heading::kNeutral>,
+        JumpingState<Heading::kLeft>,
+        JumpingState<Heading::kRight>,
+        FallingState<Heading::kNeutral>,
+        FallingState<Heading::kLeft>,
+        FallingState<Heading::kRight>>;
+}
@@ -1,26 +0,0 @@
-#pragma once
-
-#include "base_state.hpp"
-
-#include "../../../../physics/direction.hpp"
-#include "../../../../physics/icollidable.hpp"
-
-namespace graphics::elements::character
-{
-    class Character;
-
-    class FallingLeftState : public BaseState
-    {
-    public:
-        FallingLeftState(FallingLeftState &state);
-        FallingLeftState(Character *character);
-        ~FallingLeftState() {}
-
-        virtual BaseState *Clone() override;
-        virtual void Jump(double delta_time) override;
-        virtual void Jump(double delta_time, physic::Direction direction) override;
-        virtual void Stop(double delta_time) override;
-        virtual void Move(double delta_time, physic::Direction direction) override;
-        virtual void ProcessCollision(physic::ICollidable *collidable) override;
-    };
-}
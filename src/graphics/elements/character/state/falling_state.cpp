@@ -1,98 +1,135 @@
 #include "./falling_state.hpp"
 
 #include "../character.hpp"
-#include "./grounded_state.hpp"
-#include "./falling_left_state.hpp"
-#include "./falling_right_state.hpp"
-#include "../../../../math/vector.hpp"
+#include "../animation/pose_cache.hpp"
 #include "../../../../physics/direction.hpp"
 #include "../../../../physics/icollidable.hpp"
-#include "../../../../physics/rigid_body.hpp"
 
-using graphics::elements::character::BaseState;
+using graphics::elements::character::PoseCache;
+using graphics::elements::character::AnimationSystem;
 using graphics::elements::character::Character;
-using graphics::elements::character::FallingLeftState;
-using graphics::elements::character::FallingRightState;
 using graphics::elements::character::FallingState;
 using graphics::elements::character::GroundedState;
-using math::Vector;
+using graphics::elements::character::Heading;
+using graphics::elements::character::StateId;
 using physic::Direction;
 using physic::ICollidable;
-using physic::RigidBody;
 
-FallingState::FallingState(FallingState &state)
-    : BaseState(state)
-{
-    name_ = "FallingState";
-}
-
-FallingState::FallingState(Character *character)
+template <Heading heading>
+FallingState<heading>::FallingState(Character *character)
     : BaseState(character)
 {
-    character->velocity_[0] = 0;
-
+    set_horizontal_velocity(heading);
     if (character->velocity_[1] < 0)
         character->velocity_[1] = 0;
 
-    character->acceleration_ = Vector::Zero(2);
-    character->external_force_ = Vector::Zero(2);
+    ResetForces(false);
 
-    name_ = "FallingState";
+    if constexpr (heading != Heading::kNeutral)
+    {
+        character_->ResetAnimation();
+        animation_system_ = AnimationSystem(character_, PoseCache::Fall());
+    }
 }
 
-BaseState *FallingState::Clone()
+template <Heading heading>
+StateId FallingState<heading>::get_id() const
 {
-    return new FallingState(*this);
+    if constexpr (heading == Heading::kLeft)
+        return StateId::kFallingLeft;
+    else if constexpr (heading == Heading::kRight)
+        return StateId::kFallingRight;
+    else
+        return StateId::kFalling;
 }
 
-void FallingState::Jump(double delta_time)
+template <Heading heading>
+void FallingState<heading>::set_character(Character *character)
 {
-    character_->ProcessMove(delta_time);
+    BaseState::set_character(character);
+    animation_system_.set_character(character);
 }
 
-void FallingState::Jump(double delta_time, physic::Direction direction)
+template <Heading heading>
+void FallingState<heading>::Jump(double delta_time)
 {
-    if (direction == Direction::kRight)
-    {
-        if (!character_->looking_right_)
-            character_->Mirror();
-
-        character_->set_state(new FallingRightState(character_));
-    }
+    if constexpr (heading == Heading::kNeutral)
+        character_->ProcessMove(delta_time);
     else
-    {
-        if (character_->looking_right_)
-            character_->Mirror();
+        character_->set_state<FallingState<Heading::kNeutral>>();
+}
 
-        character_->set_state(new FallingLeftState(character_));
-    }
+template <Heading heading>
+void FallingState<heading>::Jump(double delta_time, physic::Direction direction)
+{
+    Move(delta_time, direction);
 }
 
-void FallingState::Stop(double delta_time)
+template <Heading heading>
+void FallingState<heading>::Stop(double delta_time)
 {
-    character_->ProcessMove(delta_time);
+    if constexpr (heading == Heading::kNeutral)
+        character_->ProcessMove(delta_time);
+    else
+        character_->set_state<FallingState<Heading::kNeutral>>();
 }
 
-void FallingState::Move(double delta_time, Direction direction)
+template <Heading heading>
+void FallingState<heading>::Move(double delta_time, Direction direction)
 {
-    if (direction == Direction::kRight)
+    if constexpr (heading == Heading::kNeutral)
     {
-        if (!character_->looking_right_)
-            character_->Mirror();
-
-        character_->set_state(new FallingRightState(character_));
+        if (direction == Direction::kRight)
+        {
+            character_->Face(Direction::kRight);
+            character_->set_state<FallingState<Heading::kRight>>();
+        }
+        else
+        {
+            character_->Face(Direction::kLeft);
+            character_->set_state<FallingState<Heading::kLeft>>();
+        }
     }
     else
     {
-        if (character_->looking_right_)
+        if (direction == ToDirection(heading))
+        {
+            character_->ProcessMove(delta_time);
+            animation_system_.Animate(delta_time);
+        }
+        else
+        {
             character_->Mirror();
+            character_->set_state<FallingState<Opposite(heading)>>();
+        }
+    }
+}
 
-        character_->set_state(new FallingLeftState(character_));
+template <Heading heading>
+void FallingState<heading>::ProcessCollision(ICollidable *collidable)
+{
+    if constexpr (heading == Heading::kNeutral)
+    {
+        character_->ProcessCollisionByBottom(collidable);
+        character_->set_state<GroundedState>();
+    }
+    else if (collidable->IsColliding(character_->get_last_position()[0], character_->get_position()[1], get_probe_width(heading), character_->get_height()))
+    {
+        character_->ProcessCollisionByBottom(collidable);
+        character_->set_state<GroundedState>();
+    }
+    else
+    {
+        ProcessCollisionBySide(heading, collidable);
+        character_->set_state<FallingState<Heading::kNeutral>>();
     }
 }
 
-void FallingState::ProcessCollision(ICollidable *collidable)
+template <Heading heading>
+void FallingState<heading>::ProcessGravity()
 {
-    character_->ProcessCollisionByBottom(collidable);
-    character_->set_state(new GroundedState(character_));
-}
\ No newline at end of file
+}
+
+template class graphics::elements::character::FallingState<Heading::kNeutral>;
+template class graphics::elements::character::FallingState<Heading::kLeft>;
+template class graphics::elements::character::FallingState<Heading::kRight>;
@@ -4,23 +4,31 @@
 
 #include "../../../../physics/direction.hpp"
 #include "../../../../physics/icollidable.hpp"
+#include "../animation/animation_system.hpp"
 
 namespace graphics::elements::character
 {
     class Character;
 
+    // Instantiated for every heading in falling_state.cpp.
+    template <Heading heading>
     class FallingState : public BaseState
     {
     public:
-        FallingState(FallingState &state);
+        FallingState() = default;
         FallingState(Character *character);
-        ~FallingState() {}
 
-        virtual BaseState *Clone() override;
-        virtual void Jump(double delta_time) override;
-        virtual void Jump(double delta_time, physic::Direction direction) override;
-        virtual void Stop(double delta_time) override;
-        virtual void Move(double delta_time, physic::Direction direction) override;
-        virtual void ProcessCollision(physic::ICollidable *collidable) override;
+        StateId get_id() const;
+        void set_character(Character *character);
+
+        void Jump(double delta_time);
+        void Jump(double delta_time, physic::Direction direction);
+        void Stop(double delta_time);
+        void Move(double delta_time, physic::Direction direction);
+        void ProcessCollision(physic::ICollidable *collidable);
+        void ProcessGravity();
+
+    private:
+        AnimationSystem animation_system_;
     };
 }
@@ -1,80 +1,67 @@
 #include "./grounded_state.hpp"
 
 #include "../character.hpp"
-#include "./walking_left_state.hpp"
-#include "./jumping_state.hpp"
-#include "./jumping_right_state.hpp"
-#include "./jumping_left_state.hpp"
-#include "./walking_right_state.hpp"
-#include "../../../../math/vector.hpp"
 #include "../../../../physics/direction.hpp"
 #include "../../../../physics/icollidable.hpp"
-#include "../../../../physics/rigid_body.hpp"
 
-using ::graphics::elements::character::BaseState;
-using ::graphics::elements::character::Character;
-using ::graphics::elements::character::GroundedState;
-using ::graphics::elements::character::JumpingLeftState;
-using ::graphics::elements::character::JumpingRightState;
-using ::graphics::elements::character::JumpingState;
-using ::graphics::elements::character::WalkingLeftState;
-using ::graphics::elements::character::WalkingRightState;
-using ::math::Vector;
-using ::physic::Direction;
-using ::physic::ICollidable;
-using ::physic::RigidBody;
-
-GroundedState::GroundedState(GroundedState &state)
-    : BaseState(state)
-{
-    name_ = "GroundedState";
-}
-
-#include <iostream>
-using namespace std;
+using graphics::elements::character::Character;
+using graphics::elements::character::GroundedState;
+using graphics::elements::character::Heading;
+using graphics::elements::character::JumpingState;
+using graphics::elements::character::StateId;
+using graphics::elements::character::WalkingState;
+using physic::Direction;
+using physic::ICollidable;
 
 GroundedState::GroundedState(Character *character)
     : BaseState(character)
 {
-    character->velocity_ = Vector::Zero(2);
-    character->acceleration_ = Vector::Zero(2);
-    character->external_force_ = character->get_weight() * -1;
+    character->velocity_[0] = 0;
+    character->velocity_[1] = 0;
+    ResetForces(true);
     character_->ResetAnimation();
-    name_ = "GroundedState";
 }
 
-BaseState *GroundedState::Clone()
+StateId GroundedState::get_id() const
 {
-    return new GroundedState(*this);
+    return StateId::kGrounded;
 }
 
 void GroundedState::Jump(double delta_time)
 {
-    character_->set_state(new JumpingState(character_));
+    character_->set_state<JumpingState<Heading::kNeutral>>();
 }
 
 void GroundedState::Jump(double delta_time, physic::Direction direction)
 {
     if (direction == Direction::kRight)
-        character_->set_state(new JumpingRightState(character_));
+        character_->set_state<JumpingState<Heading::kRight>>();
     else if (direction == Direction::kLeft)
-        character_->set_state(new JumpingLeftState(character_));
+        character_->set_state<JumpingState<Heading::kLeft>>();
+}
+
+void GroundedState::Stop(double delta_time)
+{
 }
 
 void GroundedState::Move(double delta_time, Direction direction)
 {
     if (direction == Direction::kLeft)
     {
-        if (character_->looking_right_)
-            character_->Mirror();
-
-        character_->set_state(new WalkingLeftState(character_));
+        character_->Face(Direction::kLeft);
+        character_->set_state<WalkingState<Heading::kLeft>>();
     }
     else if (direction == Direction::kRight)
     {
-        if (!character_->looking_right_)
-            character_->Mirror();
-
-        character_->set_state(new WalkingRightState(character_));
+        character_->Face(Direction::kRight);
+        character_->set_state<WalkingState<Heading::kRight>>();
     }
-}
\ No newline at end of file
+}
+
+void GroundedState::ProcessCollision(ICollidable *collidable)
+{
+}
+
+void GroundedState::ProcessGravity()
+{
+}
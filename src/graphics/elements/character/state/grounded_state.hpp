@@ -12,12 +12,16 @@ namespace graphics::elements::character
     class GroundedState : public BaseState
     {
     public:
-        GroundedState(GroundedState &state);
+        GroundedState() = default;
         GroundedState(Character *character);
 
-        virtual BaseState *Clone() override;
-        virtual void Jump(double delta_time) override;
-        virtual void Jump(double delta_time, physic::Direction direction) override;
-        virtual void Move(double delta_time, physic::Direction direction) override;
+        StateId get_id() const;
+
+        void Jump(double delta_time);
+        void Jump(double delta_time, physic::Direction direction);
+        void Stop(double delta_time);
+        void Move(double delta_time, physic::Direction direction);
+        void ProcessCollision(physic::ICollidable *collidable);
+        void ProcessGravity();
     };
 }
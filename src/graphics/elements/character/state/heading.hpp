@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../../../../physics/direction.hpp"
+
+namespace graphics::elements::character
+{
+    // Horizontal direction a state is bound to; neutral states move straight up or down.
+    enum class Heading
+    {
+        kNeutral,
+        kLeft,
+        kRight,
+    };
+
+    constexpr Heading Opposite(Heading heading)
+    {
+        return heading == Heading::kLeft ? Heading::kRight : heading == Heading::kRight ? Heading::kLeft : Heading::kNeutral;
+    }
+
+    constexpr physic::Direction ToDirection(Heading heading)
+    {
+        return heading == Heading::kLeft ? physic::Direction::kLeft : physic::Direction::kRight;
+    }
+}
@@ -1,80 +1,155 @@
 #include "./jumping_state.hpp"
 
 #include "../character.hpp"
-#include "./grounded_state.hpp"
-#include "./jumping_left_state.hpp"
-#include "./jumping_right_state.hpp"
-#include "../../../../math/vector.hpp"
+#include "../animation/pose_cache.hpp"
 #include "../../../../physics/direction.hpp"
 #include "../../../../physics/icollidable.hpp"
-#include "../../../../physics/rigid_body.hpp"
 
-using graphics::elements::character::BaseState;
+using graphics::elements::character::PoseCache;
+using graphics::elements::character::AnimationSystem;
 using graphics::elements::character::Character;
-using graphics::elements::character::GroundedState;
-using graphics::elements::character::JumpingLeftState;
-using graphics::elements::character::JumpingRightState;
+using graphics::elements::character::FallingState;
+using graphics::elements::character::Heading;
 using graphics::elements::character::JumpingState;
-using math::Vector;
+using graphics::elements::character::StateId;
 using physic::Direction;
 using physic::ICollidable;
-using physic::RigidBody;
 
-JumpingState::JumpingState(JumpingState &state)
-    : BaseState(state)
-{
-    name_ = "JumpingState";
-}
-
-JumpingState::JumpingState(Character *character)
+template <Heading heading>
+JumpingState<heading>::JumpingState(Character *character)
     : BaseState(character)
 {
-    character->velocity_[0] = 0;
+    if constexpr (heading == Heading::kNeutral)
+        character->velocity_[0] = 0;
+
     if (character->velocity_[1] == 0)
         character->velocity_ = character->initial_jump_velocity_;
-    character->acceleration_ = Vector::Zero(2);
-    character->external_force_ = Vector::Zero(2);
 
-    name_ = "JumpingState";
+    if constexpr (heading != Heading::kNeutral)
+        set_horizontal_velocity(heading);
+
+    ResetForces(false);
+
+    if constexpr (heading != Heading::kNeutral)
+    {
+        character_->ResetAnimation();
+        animation_system_ = AnimationSystem(character_, PoseCache::Jump());
+    }
+}
+
+template <Heading heading>
+StateId JumpingState<heading>::get_id() const
+{
+    if constexpr (heading == Heading::kLeft)
+        return StateId::kJumpingLeft;
+    else if constexpr (heading == Heading::kRight)
+        return StateId::kJumpingRight;
+    else
+        return StateId::kJumping;
 }
 
-BaseState *JumpingState::Clone()
+template <Heading heading>
+void JumpingState<heading>::set_character(Character *character)
 {
-    return new JumpingState(*this);
+    BaseState::set_character(character);
+    animation_system_.set_character(character);
 }
 
-void JumpingState::Jump(double delta_time)
+template <Heading heading>
+void JumpingState<heading>::Jump(double delta_time)
 {
-    if (character_->velocity_[1] > 0)
-        character_->set_state(new FallingState(character_));
+    if constexpr (heading == Heading::kNeutral)
+    {
+        if (character_->velocity_[1] > 0)
+            character_->set_state<FallingState<Heading::kNeutral>>();
+        else
+            character_->ProcessMove(delta_time);
+    }
     else
-        character_->ProcessMove(delta_time);
+    {
+        character_->set_state<JumpingState<Heading::kNeutral>>();
+    }
 }
 
-void JumpingState::Jump(double delta_time, physic::Direction direction)
+template <Heading heading>
+void JumpingState<heading>::Jump(double delta_time, physic::Direction direction)
 {
-    if (direction == Direction::kRight)
+    if constexpr (heading == Heading::kNeutral)
     {
-        if (!character_->looking_right_)
-            character_->Mirror();
-
-        character_->set_state(new JumpingRightState(character_));
+        if (direction == Direction::kRight)
+        {
+            character_->Face(Direction::kRight);
+            character_->set_state<JumpingState<Heading::kRight>>();
+        }
+        else
+        {
+            character_->Face(Direction::kLeft);
+            character_->set_state<JumpingState<Heading::kLeft>>();
+        }
     }
     else
     {
-        if (character_->looking_right_)
+        if (character_->velocity_[1] > 0)
+            character_->set_state<FallingState<heading>>();
+        else if (direction == ToDirection(heading))
+        {
+            character_->ProcessMove(delta_time);
+            animation_system_.Animate(delta_time);
+        }
+        else
+        {
             character_->Mirror();
+            character_->set_state<JumpingState<Opposite(heading)>>();
+        }
+    }
+}
+
+template <Heading heading>
+void JumpingState<heading>::Stop(double delta_time)
+{
+    character_->set_state<FallingState<Heading::kNeutral>>();
+}
 
-        character_->set_state(new JumpingLeftState(character_));
+template <Heading heading>
+void JumpingState<heading>::Move(double delta_time, Direction direction)
+{
+    if constexpr (heading != Heading::kNeutral)
+    {
+        if (direction == ToDirection(heading))
+            character_->set_state<FallingState<heading>>();
+        else
+        {
+            character_->Mirror();
+            character_->set_state<FallingState<Opposite(heading)>>();
+        }
     }
 }
 
-void JumpingState::Stop(double delta_time)
+template <Heading heading>
+void JumpingState<heading>::ProcessCollision(ICollidable *collidable)
 {
-    character_->set_state(new FallingState(character_));
+    if constexpr (heading == Heading::kNeutral)
+    {
+        character_->ProcessCollisionByTop(collidable);
+        character_->set_state<FallingState<Heading::kNeutral>>();
+    }
+    else if (collidable->IsColliding(character_->get_last_position()[0], character_->get_position()[1], get_probe_width(heading), character_->get_height()))
+    {
+        character_->ProcessCollisionByTop(collidable);
+        character_->set_state<FallingState<Heading::kNeutral>>();
+    }
+    else
+    {
+        ProcessCollisionBySide(heading, collidable);
+        character_->set_state<JumpingState<Heading::kNeutral>>();
+    }
 }
-void JumpingState::ProcessCollision(ICollidable *collidable)
+
+template <Heading heading>
+void JumpingState<heading>::ProcessGravity()
 {
-    character_->ProcessCollisionByTop(collidable);
-    character_->set_state(new FallingState(character_));
-}
\ No newline at end of file
+}
+
+template class graphics::elements::character::JumpingState<Heading::kNeutral>;
+template class graphics::elements::character::JumpingState<Heading::kLeft>;
+template class graphics::elements::character::JumpingState<Heading::kRight>;
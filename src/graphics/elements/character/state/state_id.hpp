@@ -0,0 +1,17 @@
+#pragma once
+
+namespace graphics::elements::character
+{
+    enum class StateId
+    {
+        kGrounded,
+        kWalkingLeft,
+        kWalkingRight,
+        kJumping,
+        kJumpingLeft,
+        kJumpingRight,
+        kFalling,
+        kFallingLeft,
+        kFallingRight,
+    };
+}
@@ -0,0 +1,92 @@
+#include "./walking_state.hpp"
+
+#include "../character.hpp"
+#include "../animation/pose_cache.hpp"
+#include "../../../../physics/direction.hpp"
+#include "../../../../physics/icollidable.hpp"
+
+using graphics::elements::character::PoseCache;
+using graphics::elements::character::AnimationSystem;
+using graphics::elements::character::Character;
+using graphics::elements::character::FallingState;
+using graphics::elements::character::GroundedState;
+using graphics::elements::character::Heading;
+using graphics::elements::character::JumpingState;
+using graphics::elements::character::StateId;
+using graphics::elements::character::WalkingState;
+using physic::Direction;
+using physic::ICollidable;
+
+template <Heading heading>
+WalkingState<heading>::WalkingState(Character *character)
+    : BaseState(character)
+{
+    set_horizontal_velocity(heading);
+    character->velocity_[1] = 0;
+    ResetForces(true);
+
+    character_->ResetAnimation();
+    animation_system_ = AnimationSystem(character_, PoseCache::Walk());
+}
+
+template <Heading heading>
+StateId WalkingState<heading>::get_id() const
+{
+    return heading == Heading::kLeft ? StateId::kWalkingLeft : StateId::kWalkingRight;
+}
+
+template <Heading heading>
+void WalkingState<heading>::set_character(Character *character)
+{
+    BaseState::set_character(character);
+    animation_system_.set_character(character);
+}
+
+template <Heading heading>
+void WalkingState<heading>::Jump(double delta_time)
+{
+}
+
+template <Heading heading>
+void WalkingState<heading>::Jump(double delta_time, physic::Direction direction)
+{
+    if (direction == ToDirection(heading))
+        character_->set_state<JumpingState<heading>>();
+}
+
+template <Heading heading>
+void WalkingState<heading>::Stop(double delta_time)
+{
+    character_->set_state<GroundedState>();
+}
+
+template <Heading heading>
+void WalkingState<heading>::Move(double delta_time, Direction direction)
+{
+    if (direction == ToDirection(Opposite(heading)))
+    {
+        character_->Mirror();
+        character_->set_state<WalkingState<Opposite(heading)>>();
+    }
+    else
+    {
+        character_->ProcessMove(delta_time);
+        animation_system_.Animate(delta_time);
+    }
+}
+
+template <Heading heading>
+void WalkingState<heading>::ProcessCollision(ICollidable *collidable)
+{
+    ProcessCollisionBySide(heading, collidable);
+    character_->set_state<GroundedState>();
+}
+
+template <Heading heading>
+void WalkingState<heading>::ProcessGravity()
+{
+    character_->set_state<FallingState<heading>>();
+}
+
+template class graphics::elements::character::WalkingState<Heading::kLeft>;
+template class graphics::elements::character::WalkingState<Heading::kRight>;
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "base_state.hpp"
+
+#include "../../../../physics/direction.hpp"
+#include "../../../../physics/icollidable.hpp"
+#include "../animation/animation_system.hpp"
+
+namespace graphics::elements::character
+{
+    class Character;
+
+    // Instantiated for the left and right headings in walking_state.cpp.
+    template <Heading heading>
+    class WalkingState : public BaseState
+    {
+    public:
+        WalkingState() = default;
+        WalkingState(Character *character);
+
+        StateId get_id() const;
+        void set_character(Character *character);
+
+        void Jump(double delta_time);
+        void Jump(double delta_time, physic::Direction direction);
+        void Stop(double delta_time);
+        void Move(double delta_time, physic::Direction direction);
+        void ProcessCollision(physic::ICollidable *collidable);
+        void ProcessGravity();
+
+    private:
+        AnimationSystem animation_system_;
+    };
+}
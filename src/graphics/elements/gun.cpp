@@ -5,48 +5,51 @@
 #include "../../physics/rigid_body.hpp"
 #include "../../math/vector.hpp"
 #include "../color/rgba.hpp"
-#include "../color/rgba_factory.hpp"
+#include "../color/palette.hpp"
 #include "../shapes/rectangle.hpp"
 #include "./character/character.hpp"
-#include "bullet.hpp"
+#include "bullet_system.hpp"
+#include "bullet_emitter.hpp"
 
+namespace palette = ::graphics::color::palette;
 using ::graphics::color::RGBA;
-using ::graphics::color::RGBAFactory;
-using ::graphics::elements::Bullet;
+using ::graphics::elements::BulletEmitter;
+using ::graphics::elements::BulletSystem;
 using ::graphics::elements::Gun;
+using ::graphics::rendering::BatchRenderer;
 using ::graphics::elements::character::Character;
 using ::graphics::shapes::Rectangle;
+using ::math::AffineTransform;
 using ::math::Vector;
+using ::physic::ICollidable;
 
 Gun::Gun(Vector &initial_position, double width, double height)
     : RigidBody(2)
 {
     Vector body_initial_position = initial_position;
     body_initial_position[1] -= height / 2;
-    body_ = new Rectangle(body_initial_position, width, height, RGBAFactory::get_color("black"));
+    body_ = new Rectangle(body_initial_position, width, height, palette::kBlack);
 
     double barrel_width = body_->get_width() / 2;
     double barrel_height = body_->get_height() / 2;
     Vector barrel_initial_position = body_->get_center_position();
     barrel_initial_position[0] += width / 2;
     barrel_initial_position[1] -= barrel_height / 3;
-    barrel_ = new Rectangle(barrel_initial_position, barrel_width, barrel_height, RGBAFactory::get_color("black"));
+    barrel_ = new Rectangle(barrel_initial_position, barrel_width, barrel_height, palette::kBlack);
 
     double grip_width = body_->get_width() / 4;
     double grip_height = body_->get_height();
     Vector grip_initial_position = body_->get_center_position();
     grip_initial_position[0] -= (body_->get_width() - grip_width) / 2;
     grip_initial_position[1] += body_->get_height() / 2;
-    grip_ = new Rectangle(grip_initial_position, grip_width, grip_height, RGBAFactory::get_color("black"));
+    grip_ = new Rectangle(grip_initial_position, grip_width, grip_height, palette::kBlack);
 
     double magazine_width = body_->get_width() / 4;
     double magazine_height = body_->get_height() / 2;
     Vector magazine_initial_position = body_->get_center_position();
     magazine_initial_position[0] -= (body_->get_width() - magazine_width * 4) / 2;
     magazine_initial_position[1] += body_->get_height() / 2;
-    magazine_ = new Rectangle(magazine_initial_position, magazine_width, magazine_height, RGBAFactory::get_color("black"));
-
-    angle_ = 0;
+    magazine_ = new Rectangle(magazine_initial_position, magazine_width, magazine_height, palette::kBlack);
 }
 
 Gun::~Gun()
@@ -55,53 +58,52 @@ Gun::~Gun()
     delete barrel_;
     delete grip_;
     delete magazine_;
+    delete emitter_;
 }
 
-Bullet *Gun::Shoot(bool invert)
+int Gun::Shoot(const AffineTransform &transform, double angle, bool invert, BulletSystem &bullet_system, ICollidable *owner, ParticleSystem *particle_system)
 {
-    double velocity_module = invert ? -0.05 : 0.05;
+    Vector position = transform.Apply(barrel_->get_center_position());
+    double direction = invert ? angle + M_PI : angle;
 
-    Vector velocity = Vector::Zero(2);
-    velocity[0] = velocity_module * std::cos(angle_);
-    velocity[1] = velocity_module * std::sin(angle_);
-    return new Bullet(barrel_->get_center_position(), velocity, 0.5);
-}
+    int fired = 0;
+    if (emitter_ != nullptr)
+        fired = emitter_->Emit(position[0], position[1], direction, owner, bullet_system);
+    else
+    {
+        double velocity_module = invert ? -0.05 : 0.05;
 
-void Gun::Render()
-{
-    body_->Draw();
-    barrel_->Draw();
-    grip_->Draw();
-    magazine_->Draw();
-}
+        double velocity_x = velocity_module * std::cos(angle);
+        double velocity_y = velocity_module * std::sin(angle);
+        fired = bullet_system.Spawn(position[0], position[1], velocity_x, velocity_y, 0.5, owner).IsNull() ? 0 : 1;
+    }
 
-void Gun::Translate(const math::Vector &translation, bool translate_position)
-{
-    body_->Translate(translation);
-    barrel_->Translate(translation);
-    grip_->Translate(translation);
-    magazine_->Translate(translation);
+    if (fired > 0 && particle_system != nullptr)
+        particle_system->Emit(ParticleSystem::muzzle_flash_effect_, position[0], position[1], direction);
 
-    if (translate_position)
-        position_ += translation;
+    return fired;
 }
 
-void Gun::Scale(const math::Vector &center, double sx, double sy)
+void Gun::set_emitter(BulletEmitter *emitter)
 {
-    body_->Scale(center, sx, sy);
-    barrel_->Scale(center, sx, sy);
-    grip_->Scale(center, sx, sy);
-    magazine_->Scale(center, sx, sy);
+    delete emitter_;
+    emitter_ = emitter;
 }
 
-void Gun::Rotate(const math::Vector &center, double angle)
+void Gun::Render(BatchRenderer &renderer, const AffineTransform &transform)
 {
-    body_->Rotate(center, angle);
-    barrel_->Rotate(center, angle);
-    grip_->Rotate(center, angle);
-    magazine_->Rotate(center, angle);
+    body_->Draw(renderer, transform);
+    barrel_->Draw(renderer, transform);
+    grip_->Draw(renderer, transform);
+    magazine_->Draw(renderer, transform);
+}
 
-    angle_ = fmod(angle_ + angle, M_PI * 2);
+void Gun::Translate(const math::Vector &translation)
+{
+    body_->Translate(translation);
+    barrel_->Translate(translation);
+    grip_->Translate(translation);
+    magazine_->Translate(translation);
 }
 
 Vector Gun::get_position()
@@ -118,14 +120,3 @@ double Gun::get_height()
 {
     return height_;
 }
-
-double Gun::get_angle()
-{
-    return angle_;
-}
-
-void Gun::Mirror(math::Vector &mirror_point)
-{
-    Scale(mirror_point, -1, 1);
-    angle_ = -angle_;
-}
\ No newline at end of file
@@ -2,10 +2,15 @@
 
 #include "../../physics/rigid_body.hpp"
 #include "../../math/vector.hpp"
+#include "../../math/affine_transform.hpp"
 #include "../color/rgba.hpp"
 #include "../shapes/rectangle.hpp"
+#include "../rendering/batch_renderer.hpp"
 #include "./character/character.hpp"
-#include "bullet.hpp"
+#include "bullet_system.hpp"
+#include "bullet_emitter.hpp"
+#include "particle_system.hpp"
+#include "../../physics/icollidable.hpp"
 
 namespace graphics::elements
 {
@@ -16,30 +21,30 @@ namespace graphics::elements
         Gun(math::Vector &initial_position, double width, double height);
         ~Gun();
 
-        Bullet *Shoot(bool invert);
+        // The transform places the gun's geometry in the world and angle is where it points.
+        // Returns how many bullets were spawned; a gun without emitter fires one. A muzzle
+        // flash goes to the particle system, when there is one, if anything was fired.
+        int Shoot(const math::AffineTransform &transform, double angle, bool invert, BulletSystem &bullet_system, physic::ICollidable *owner, ParticleSystem *particle_system = nullptr);
+        void set_emitter(BulletEmitter *emitter);
 
-        void Render();
-        void Translate(const math::Vector &translation, bool translate_position);
-        void Scale(const math::Vector &center, double sx, double sy);
-        void Rotate(const math::Vector &center, double angle);
-
-        void Mirror(math::Vector &mirror_point);
+        void Render(graphics::rendering::BatchRenderer &renderer, const math::AffineTransform &transform);
+        void Translate(const math::Vector &translation);
 
         math::Vector get_position();
         double get_width();
         double get_height();
-        double get_angle();
 
     private:
         double width_;
         double height_;
-        double angle_;
 
         graphics::shapes::Rectangle *body_;
         graphics::shapes::Rectangle *barrel_;
         graphics::shapes::Rectangle *grip_;
         graphics::shapes::Rectangle *magazine_;
 
+        BulletEmitter *emitter_ = nullptr;
+
         friend graphics::elements::character::Character;
     };
 }
\ No newline at end of file
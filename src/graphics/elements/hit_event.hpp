@@ -0,0 +1,26 @@
+#pragma once
+
+#include "bullet_handle.hpp"
+#include "../../physics/icollidable.hpp"
+
+namespace graphics::elements
+{
+    enum class HitTarget
+    {
+        kObstacle,
+        kEnemy,
+        kPlayer
+    };
+
+    struct HitEvent
+    {
+        HitTarget target_type;
+        BulletHandle bullet;
+        physic::ICollidable *target;
+        // Where the bullet was and where it was heading when it hit.
+        double x;
+        double y;
+        double velocity_x;
+        double velocity_y;
+    };
+}
@@ -1,15 +1,33 @@
 #include "map.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
 #include "../shapes/rectangle.hpp"
 #include "../elements/obstacle.hpp"
+#include "../rendering/camera.hpp"
+#include "../rendering/static_mesh.hpp"
+#include "../../math/vector.hpp"
 
 using ::graphics::elements::Map;
 using ::graphics::elements::Obstacle;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::Camera;
+using ::graphics::rendering::StaticMesh;
 using ::graphics::shapes::Rectangle;
+using ::math::Vector;
+using ::std::floor;
+using ::std::max;
+using ::std::min;
+using ::std::vector;
 
 void Map::set_background(Rectangle *background)
 {
     background_ = background;
+    mesh_.Clear();
+    ClearChunks();
 }
 
 Map::~Map()
@@ -17,14 +35,129 @@ Map::~Map()
     delete background_;
     for (auto obstacle : obstacles_)
         delete obstacle;
+    ClearChunks();
+}
+
+void Map::Render(BatchRenderer &renderer)
+{
+    if (!IsBaked())
+    {
+        Submit(renderer);
+        return;
+    }
+
+    renderer.SubmitStaticMesh(mesh_);
+    for (auto &chunk : chunks_)
+        renderer.SubmitStaticMesh(*chunk.mesh);
+}
+
+void Map::Render(BatchRenderer &renderer, Camera &camera)
+{
+    int visible = 0;
+    int culled = 0;
+
+    if (IsBaked())
+    {
+        renderer.SubmitStaticMesh(mesh_);
+
+        for (auto &chunk : chunks_)
+        {
+            if (camera.IsVisible(chunk.left, chunk.top, chunk.right - chunk.left, chunk.bottom - chunk.top))
+            {
+                renderer.SubmitStaticMesh(*chunk.mesh);
+                visible += chunk.obstacle_count;
+            }
+            else
+                culled += chunk.obstacle_count;
+        }
+    }
+    else
+    {
+        background_->Draw(renderer);
+
+        for (auto &obstacle : obstacles_)
+        {
+            Vector position = obstacle->get_position();
+            if (camera.IsVisible(position[0], position[1], obstacle->get_width(), obstacle->get_height()))
+            {
+                obstacle->Render(renderer);
+                visible++;
+            }
+            else
+                culled++;
+        }
+    }
+
+    camera.Count(visible, culled);
+}
+
+void Map::Bake(BatchRenderer &renderer)
+{
+    ClearChunks();
+
+    renderer.Begin();
+    background_->Draw(renderer);
+    renderer.Bake(mesh_);
+
+    std::map<long long, vector<Obstacle *>> strips;
+    for (auto &obstacle : obstacles_)
+    {
+        if (obstacle->get_width() > chunk_width_)
+            BakeChunk(renderer, {obstacle});
+        else
+            strips[(long long)floor(obstacle->get_position()[0] / chunk_width_)].push_back(obstacle);
+    }
+
+    for (auto &strip : strips)
+        BakeChunk(renderer, strip.second);
 }
 
-void Map::Render()
+bool Map::IsBaked() const
 {
-    background_->Draw();
+    return !mesh_.IsEmpty();
+}
+
+int Map::get_chunk_count() const
+{
+    return chunks_.size();
+}
+
+void Map::Submit(BatchRenderer &renderer)
+{
+    background_->Draw(renderer);
 
     for (auto &obstacle : obstacles_)
-        obstacle->Render();
+        obstacle->Render(renderer);
+}
+
+void Map::BakeChunk(BatchRenderer &renderer, const vector<Obstacle *> &obstacles)
+{
+    Chunk chunk = {new StaticMesh(), 0, 0, 0, 0, (int)obstacles.size()};
+
+    renderer.Begin();
+    for (size_t i = 0; i < obstacles.size(); i++)
+    {
+        Vector position = obstacles[i]->get_position();
+        double right = position[0] + obstacles[i]->get_width();
+        double bottom = position[1] + obstacles[i]->get_height();
+
+        chunk.left = i == 0 ? position[0] : min(chunk.left, position[0]);
+        chunk.top = i == 0 ? position[1] : min(chunk.top, position[1]);
+        chunk.right = i == 0 ? right : max(chunk.right, right);
+        chunk.bottom = i == 0 ? bottom : max(chunk.bottom, bottom);
+
+        obstacles[i]->Render(renderer);
+    }
+    renderer.Bake(*chunk.mesh);
+
+    chunks_.push_back(chunk);
+}
+
+void Map::ClearChunks()
+{
+    for (auto &chunk : chunks_)
+        delete chunk.mesh;
+    chunks_.clear();
 }
 
 double Map::get_width() const
@@ -40,4 +173,11 @@ double Map::get_height() const
 void Map::AddObstacle(Obstacle *obstacle)
 {
     obstacles_.push_back(obstacle);
+    mesh_.Clear();
+    ClearChunks();
+}
+
+const std::vector<Obstacle *> &Map::get_obstacles() const
+{
+    return obstacles_;
 }
\ No newline at end of file
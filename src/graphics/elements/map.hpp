@@ -5,6 +5,9 @@
 #include <vector>
 
 #include "../shapes/rectangle.hpp"
+#include "../rendering/batch_renderer.hpp"
+#include "../rendering/camera.hpp"
+#include "../rendering/static_mesh.hpp"
 
 namespace graphics::elements
 {
@@ -19,10 +22,40 @@ namespace graphics::elements
         double get_height() const;
 
         void AddObstacle(Obstacle *obstacle);
-        void Render();
+        const std::vector<Obstacle *> &get_obstacles() const;
+        void Render(graphics::rendering::BatchRenderer &renderer);
+        // Skips the obstacle chunks outside the camera and counts the obstacles it kept.
+        void Render(graphics::rendering::BatchRenderer &renderer, graphics::rendering::Camera &camera);
+
+        // The background and obstacles never change after loading, so they can be built
+        // once and replayed. Obstacles are baked in vertical strips so off screen strips can
+        // be skipped; one wider than a strip gets a chunk of its own. Adding an obstacle
+        // drops the baked geometry.
+        void Bake(graphics::rendering::BatchRenderer &renderer);
+        bool IsBaked() const;
+
+        int get_chunk_count() const;
+
+        inline static double chunk_width_ = 64;
 
     private:
+        struct Chunk
+        {
+            graphics::rendering::StaticMesh *mesh;
+            double left;
+            double top;
+            double right;
+            double bottom;
+            int obstacle_count;
+        };
+
         shapes::Rectangle* background_;
         std::vector<Obstacle*> obstacles_;
+        graphics::rendering::StaticMesh mesh_;
+        std::vector<Chunk> chunks_;
+
+        void Submit(graphics::rendering::BatchRenderer &renderer);
+        void BakeChunk(graphics::rendering::BatchRenderer &renderer, const std::vector<Obstacle *> &obstacles);
+        void ClearChunks();
     };
 }
\ No newline at end of file
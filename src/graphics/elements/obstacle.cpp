@@ -2,6 +2,7 @@
 
 using ::graphics::color::RGBA;
 using ::graphics::elements::Obstacle;
+using ::graphics::rendering::BatchRenderer;
 using ::graphics::shapes::Rectangle;
 using ::math::Vector;
 using ::physic::ICollidable;
@@ -21,9 +22,9 @@ Obstacle::~Obstacle()
     delete shape_;
 }
 
-void Obstacle::Render()
+void Obstacle::Render(BatchRenderer &renderer)
 {
-    shape_->Draw();
+    shape_->Draw(renderer);
 }
 
 Vector Obstacle::get_position()
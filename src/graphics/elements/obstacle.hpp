@@ -4,6 +4,7 @@
 #include "../../math/vector.hpp"
 #include "../color/rgba.hpp"
 #include "../shapes/rectangle.hpp"
+#include "../rendering/batch_renderer.hpp"
 #include "../../physics/icollidable.hpp"
 
 namespace graphics::elements
@@ -15,7 +16,7 @@ namespace graphics::elements
         Obstacle(math::Vector &initial_position, double width, double height, graphics::color::RGBA &color);
         ~Obstacle();
 
-        void Render();
+        void Render(graphics::rendering::BatchRenderer &renderer);
 
         math::Vector get_position() override;
         double get_width() override;
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cmath>
+
+#include "../color/rgba.hpp"
+#include "../color/palette.hpp"
+
+namespace graphics::elements
+{
+    struct ParticleEffect
+    {
+        int count = 8;
+        // Speeds in units per millisecond, picked uniformly between the two.
+        double min_speed = 0.02;
+        double max_speed = 0.06;
+        // Cone width around the emission angle in radians; 2 pi sprays everywhere.
+        double spread = M_PI / 4;
+        // Milliseconds; every particle lives between half and all of it.
+        double lifetime = 120;
+        // Edge of the square at birth, shrinking to nothing over the particle's life.
+        double size = 1;
+        color::RGBA color = color::palette::kWhite;
+    };
+}
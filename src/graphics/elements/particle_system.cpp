@@ -0,0 +1,160 @@
+#include "particle_system.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "particle_effect.hpp"
+#include "../rendering/mesh_template_registry.hpp"
+#include "../../math/affine_transform.hpp"
+
+using ::graphics::elements::ParticleEffect;
+using ::graphics::elements::ParticleSystem;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::Camera;
+using ::graphics::rendering::MeshTemplateRegistry;
+using ::math::AffineTransform;
+
+#pragma region Constructors and Destructors
+ParticleSystem::ParticleSystem(int capacity)
+{
+    capacity_ = capacity;
+    size_ = 0;
+
+    x_.assign(capacity_, 0);
+    y_.assign(capacity_, 0);
+    velocity_x_.assign(capacity_, 0);
+    velocity_y_.assign(capacity_, 0);
+    age_.assign(capacity_, 0);
+    lifetime_.assign(capacity_, 0);
+    size_at_birth_.assign(capacity_, 0);
+    color_.assign(capacity_, color::RGBA());
+
+    random_state_ = 2463534242u;
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+int ParticleSystem::Emit(const ParticleEffect &effect, double x, double y, double angle)
+{
+    int count = std::min(effect.count, capacity_ - size_);
+
+    for (int i = size_; i < size_ + count; i++)
+    {
+        double direction = angle + (NextRandom() - 0.5) * effect.spread;
+        double speed = effect.min_speed + NextRandom() * (effect.max_speed - effect.min_speed);
+
+        x_[i] = x;
+        y_[i] = y;
+        velocity_x_[i] = speed * std::cos(direction);
+        velocity_y_[i] = speed * std::sin(direction);
+        age_[i] = 0;
+        lifetime_[i] = effect.lifetime * (0.5 + NextRandom() * 0.5);
+        size_at_birth_[i] = effect.size;
+        color_[i] = effect.color;
+    }
+
+    size_ += count;
+    return count;
+}
+
+void ParticleSystem::Clear()
+{
+    size_ = 0;
+}
+
+void ParticleSystem::Update(double delta_time)
+{
+    float *__restrict__ x = x_.data();
+    float *__restrict__ y = y_.data();
+    const float *__restrict__ velocity_x = velocity_x_.data();
+    float *__restrict__ velocity_y = velocity_y_.data();
+    float *__restrict__ age = age_.data();
+    float time = delta_time;
+    float pull = gravity_ * delta_time;
+    int size = size_;
+
+#pragma GCC ivdep
+    for (int i = 0; i < size; i++)
+    {
+        x[i] += velocity_x[i] * time;
+        y[i] += velocity_y[i] * time;
+        velocity_y[i] += pull;
+        age[i] += time;
+    }
+
+    // Keeps emission order, so older particles are still drawn first.
+    int live = 0;
+    for (int i = 0; i < size; i++)
+    {
+        if (age_[i] >= lifetime_[i])
+            continue;
+
+        if (live != i)
+        {
+            x_[live] = x_[i];
+            y_[live] = y_[i];
+            velocity_x_[live] = velocity_x_[i];
+            velocity_y_[live] = velocity_y_[i];
+            age_[live] = age_[i];
+            lifetime_[live] = lifetime_[i];
+            size_at_birth_[live] = size_at_birth_[i];
+            color_[live] = color_[i];
+        }
+        live++;
+    }
+    size_ = live;
+}
+
+void ParticleSystem::Render(BatchRenderer &renderer)
+{
+    for (int i = 0; i < size_; i++)
+        SubmitParticle(renderer, i);
+}
+
+void ParticleSystem::Render(BatchRenderer &renderer, Camera &camera)
+{
+    int visible = 0;
+
+    for (int i = 0; i < size_; i++)
+    {
+        double size = size_at_birth_[i];
+        if (!camera.IsVisible(x_[i] - size / 2, y_[i] - size / 2, size, size))
+            continue;
+
+        SubmitParticle(renderer, i);
+        visible++;
+    }
+
+    camera.Count(visible, size_ - visible);
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+double ParticleSystem::NextRandom()
+{
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    return random_state_ / 4294967296.0;
+}
+
+void ParticleSystem::SubmitParticle(BatchRenderer &renderer, int index)
+{
+    double size = size_at_birth_[index] * (1 - age_[index] / lifetime_[index]);
+    AffineTransform placement(size, 0, 0, size, x_[index] - size / 2, y_[index] - size / 2);
+
+    renderer.SubmitMesh(MeshTemplateRegistry::get_unit_quad(), color_[index], placement);
+}
+#pragma endregion // Private Methods
+
+#pragma region Getters
+int ParticleSystem::get_size() const
+{
+    return size_;
+}
+
+int ParticleSystem::get_capacity() const
+{
+    return capacity_;
+}
+#pragma endregion // Getters
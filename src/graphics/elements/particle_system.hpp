@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include "particle_effect.hpp"
+#include "../color/rgba.hpp"
+#include "../rendering/batch_renderer.hpp"
+#include "../rendering/camera.hpp"
+
+namespace graphics::elements
+{
+    // Short-lived cosmetic particles in parallel arrays sized once at construction. Live
+    // particles stay packed in [0, size), so Update is one streaming loop followed by a
+    // compaction of the expired ones, and nothing is allocated after the constructor.
+    // Emission past the capacity is dropped.
+    class ParticleSystem
+    {
+    public:
+        ParticleSystem(int capacity = default_capacity_);
+        ParticleSystem(const ParticleSystem &other) = delete;
+        ~ParticleSystem() = default;
+
+        ParticleSystem &operator=(const ParticleSystem &other) = delete;
+
+        // Sprays the effect from a point around the angle; returns how many particles fit.
+        int Emit(const ParticleEffect &effect, double x, double y, double angle);
+        void Clear();
+
+        void Update(double delta_time);
+        void Render(graphics::rendering::BatchRenderer &renderer);
+        void Render(graphics::rendering::BatchRenderer &renderer, graphics::rendering::Camera &camera);
+
+        int get_size() const;
+        int get_capacity() const;
+
+        inline static int default_capacity_ = 4096;
+        // Downward pull in units per square millisecond.
+        inline static double gravity_ = 0.0001;
+
+        inline static ParticleEffect muzzle_flash_effect_ = {6, 0.01, 0.03, M_PI / 6, 60, 1.2, color::palette::kYellow};
+        inline static ParticleEffect impact_effect_ = {10, 0.01, 0.04, M_PI, 150, 1.5, color::palette::kOrange};
+
+    private:
+        int capacity_;
+        int size_;
+
+        std::vector<float> x_;
+        std::vector<float> y_;
+        std::vector<float> velocity_x_;
+        std::vector<float> velocity_y_;
+        std::vector<float> age_;
+        std::vector<float> lifetime_;
+        std::vector<float> size_at_birth_;
+        std::vector<color::RGBA> color_;
+
+        unsigned int random_state_;
+
+        // Uniform in [0, 1); xorshift, so emitting never touches the heap or a lock.
+        double NextRandom();
+        void SubmitParticle(graphics::rendering::BatchRenderer &renderer, int index);
+    };
+}
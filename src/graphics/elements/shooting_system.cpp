@@ -1,44 +1,54 @@
 #include "shooting_system.hpp"
 
 #include <vector>
-#include <algorithm>
+#include <unordered_map>
 
-#include "bullet.hpp"
+#include "bullet_handle.hpp"
+#include "bullet_system.hpp"
+#include "hit_event.hpp"
+#include "../rendering/camera.hpp"
 #include "../../physics/icollidable.hpp"
 
+using ::graphics::elements::BulletHandle;
+using ::graphics::elements::BulletSystem;
+using ::graphics::elements::HitEvent;
+using ::graphics::elements::HitTarget;
 using ::graphics::elements::ShootingSystem;
+using ::graphics::rendering::Camera;
 using ::physic::ICollidable;
-using ::std::remove;
+using ::physic::SpatialGrid;
+using ::std::unordered_map;
 using ::std::vector;
 
-void ShootingSystem::AddBullet(ICollidable *bullet)
+void ShootingSystem::set_bullet_system(BulletSystem *bullet_system)
 {
-    bullets_.push_back(bullet);
-}
-
-void ShootingSystem::RemoveBullet(ICollidable *bullet)
-{
-    bullets_.erase(remove(bullets_.begin(), bullets_.end(), bullet), bullets_.end());
+    bullet_system_ = bullet_system;
 }
 
 void ShootingSystem::AddObstacle(ICollidable *obstacle)
 {
+    obstacle_indices_[obstacle] = obstacles_.size();
     obstacles_.push_back(obstacle);
+    obstacle_grid_.Insert(obstacle);
 }
 
 void ShootingSystem::RemoveObstacle(ICollidable *obstacle)
 {
-    obstacles_.erase(remove(obstacles_.begin(), obstacles_.end(), obstacle), obstacles_.end());
+    SwapAndPop(obstacles_, obstacle_indices_, obstacle);
+    obstacle_grid_.Remove(obstacle);
 }
 
 void ShootingSystem::AddEnemy(ICollidable *enemy)
 {
+    enemy_indices_[enemy] = enemies_.size();
     enemies_.push_back(enemy);
+    enemy_grid_.Insert(enemy);
 }
 
 void ShootingSystem::RemoveEnemy(ICollidable *enemy)
 {
-    enemies_.erase(remove(enemies_.begin(), enemies_.end(), enemy), enemies_.end());
+    SwapAndPop(enemies_, enemy_indices_, enemy);
+    enemy_grid_.Remove(enemy);
 }
 
 void ShootingSystem::set_player(ICollidable *player)
@@ -48,44 +58,101 @@ void ShootingSystem::set_player(ICollidable *player)
 
 void ShootingSystem::ProcessShoots()
 {
-    for (auto &bullet : bullets_)
+    for (auto &enemy : enemies_)
+        enemy_grid_.Update(enemy);
+
+    for (int i = 0; i < bullet_system_->get_size(); i++)
     {
+        BulletHandle handle = bullet_system_->get_handle(i);
+        ICollidable *owner = bullet_system_->get_owner(i);
+        double radius = bullet_system_->get_radius(i);
+        double x = bullet_system_->get_x(i) - radius;
+        double y = bullet_system_->get_y(i) - radius;
+        double size = radius * 2;
+        double velocity_x = bullet_system_->get_velocity_x(i);
+        double velocity_y = bullet_system_->get_velocity_y(i);
         bool hit = false;
 
-        for (auto &obstacle : obstacles_)
+        candidates_.clear();
+        obstacle_grid_.Query(x, y, size, size, candidates_);
+        for (auto &obstacle : candidates_)
         {
-            if (bullet->IsColliding(obstacle))
+            if (obstacle->IsColliding(x, y, size, size))
             {
                 hit = true;
-                hit_bullets_.push_back(bullet);
+                hit_events_.push_back({HitTarget::kObstacle, handle, obstacle, x + radius, y + radius, velocity_x, velocity_y});
                 break;
             }
         }
 
         if (!hit)
         {
-            for (auto &enemy : enemies_)
+            candidates_.clear();
+            enemy_grid_.Query(x, y, size, size, candidates_);
+            for (auto &enemy : candidates_)
             {
-                if (bullet->IsColliding(enemy))
+                if (owner == player_ && enemy->IsColliding(x, y, size, size))
                 {
                     hit = true;
-                    hit_enemies_.push_back(enemy);
-                    hit_bullets_.push_back(bullet);
+                    hit_events_.push_back({HitTarget::kEnemy, handle, enemy, x + radius, y + radius, velocity_x, velocity_y});
                     break;
                 }
             }
         }
 
-        if (!hit && bullet->IsColliding(player_))
-        {
-            hit_bullets_.push_back(bullet);
-            player_hit_ = true;
-        }
+        if (!hit && player_ != owner && player_->IsColliding(x, y, size, size))
+            hit_events_.push_back({HitTarget::kPlayer, handle, player_, x + radius, y + radius, velocity_x, velocity_y});
     }
+}
+
+void ShootingSystem::QueryEnemies(double x, double y, double width, double height, vector<ICollidable *> &result)
+{
+    enemy_grid_.Query(x, y, width, height, result);
+}
+
+void ShootingSystem::QueryVisibleEnemies(Camera &camera, vector<ICollidable *> &result)
+{
+    double margin = Camera::cull_margin_;
+
+    result.clear();
+    QueryEnemies(camera.get_left() - margin, camera.get_top() - margin, camera.get_width() + margin * 2, camera.get_height() + margin * 2, result);
+
+    camera.Count(result.size(), enemies_.size() - result.size());
+}
+
+const SpatialGrid &ShootingSystem::get_obstacle_grid() const
+{
+    return obstacle_grid_;
+}
+
+const SpatialGrid &ShootingSystem::get_enemy_grid() const
+{
+    return enemy_grid_;
+}
+
+const vector<HitEvent> &ShootingSystem::get_hit_events() const
+{
+    return hit_events_;
+}
 
-    for (auto &bullet : hit_bullets_)
-        RemoveBullet(bullet);
+void ShootingSystem::ClearHitEvents()
+{
+    hit_events_.clear();
+}
+
+void ShootingSystem::SwapAndPop(vector<ICollidable *> &collidables, unordered_map<ICollidable *, size_t> &indices, ICollidable *collidable)
+{
+    auto it = indices.find(collidable);
+    if (it == indices.end())
+        return;
 
-    for (auto &enemy : hit_enemies_)
-        RemoveEnemy(enemy);
-}
\ No newline at end of file
+    size_t index = it->second;
+    indices.erase(it);
+
+    if (index != collidables.size() - 1)
+    {
+        collidables[index] = collidables.back();
+        indices[collidables[index]] = index;
+    }
+    collidables.pop_back();
+}
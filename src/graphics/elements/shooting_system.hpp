@@ -1,17 +1,21 @@
 #pragma once
 
 #include <vector>
+#include <unordered_map>
 
-#include "bullet.hpp"
+#include "bullet_handle.hpp"
+#include "bullet_system.hpp"
+#include "hit_event.hpp"
+#include "../rendering/camera.hpp"
 #include "../../physics/icollidable.hpp"
+#include "../../physics/spatial_grid.hpp"
 
 namespace graphics::elements
 {
     class ShootingSystem
     {
     public:
-        void AddBullet(physic::ICollidable *bullet);
-        void RemoveBullet(physic::ICollidable *bullet);
+        void set_bullet_system(BulletSystem *bullet_system);
 
         void AddObstacle(physic::ICollidable *obstacle);
         void RemoveObstacle(physic::ICollidable *obstacle);
@@ -21,16 +25,34 @@ namespace graphics::elements
 
         void set_player(physic::ICollidable *player);
 
+        // Reports at most one hit per bullet; nothing is removed until the caller sweeps the events.
+        // Only the player's bullets hit enemies.
         void ProcessShoots();
 
-        std::vector<physic::ICollidable *> hit_bullets_;
-        std::vector<physic::ICollidable *> hit_enemies_;
-        bool player_hit_ = false;
+        // Enemies whose box overlaps the rectangle, from the grid refreshed by the last ProcessShoots.
+        void QueryEnemies(double x, double y, double width, double height, std::vector<physic::ICollidable *> &result);
+        // Enemies inside the camera's padded view; the rest are counted as culled on the camera.
+        void QueryVisibleEnemies(graphics::rendering::Camera &camera, std::vector<physic::ICollidable *> &result);
+
+        const physic::SpatialGrid &get_obstacle_grid() const;
+        const physic::SpatialGrid &get_enemy_grid() const;
+        const std::vector<HitEvent> &get_hit_events() const;
+        void ClearHitEvents();
 
     private:
-        std::vector<physic::ICollidable *> bullets_;
+        BulletSystem *bullet_system_;
         std::vector<physic::ICollidable *> obstacles_;
         std::vector<physic::ICollidable *> enemies_;
+        std::unordered_map<physic::ICollidable *, size_t> obstacle_indices_;
+        std::unordered_map<physic::ICollidable *, size_t> enemy_indices_;
         physic::ICollidable *player_;
+
+        physic::SpatialGrid obstacle_grid_;
+        physic::SpatialGrid enemy_grid_;
+        std::vector<physic::ICollidable *> candidates_;
+
+        std::vector<HitEvent> hit_events_;
+
+        static void SwapAndPop(std::vector<physic::ICollidable *> &collidables, std::unordered_map<physic::ICollidable *, size_t> &indices, physic::ICollidable *collidable);
     };
-}
\ No newline at end of file
+}
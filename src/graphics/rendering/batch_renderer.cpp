@@ -0,0 +1,224 @@
+#include "batch_renderer.hpp"
+
+#include <cmath>
+
+#include "irender_backend.hpp"
+#include "mesh_template.hpp"
+#include "mesh_template_registry.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::IRenderBackend;
+using ::graphics::rendering::MeshTemplate;
+using ::graphics::rendering::MeshTemplateRegistry;
+using ::graphics::rendering::StaticMesh;
+using ::math::AffineTransform;
+using ::math::Matrix;
+using ::math::Vector;
+
+#pragma region Constructors and Destructors
+BatchRenderer::BatchRenderer(int capacity)
+{
+    backend_ = nullptr;
+
+    positions_.reserve(capacity * 2);
+    colors_.reserve(capacity * 4);
+    indices_.reserve(capacity * 3);
+
+    // The last level is also used when no tolerance can be met.
+    for (int segments : MeshTemplateRegistry::get_circle_levels())
+        circle_templates_.push_back({segments, 0, &MeshTemplateRegistry::get_unit_circle(segments)});
+    set_pixels_per_unit(1);
+
+    draw_calls_ = 0;
+    vertex_count_ = 0;
+    frame_draw_calls_ = 0;
+    frame_vertex_count_ = 0;
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+void BatchRenderer::Begin()
+{
+    positions_.clear();
+    colors_.clear();
+    indices_.clear();
+    draw_calls_ = 0;
+    vertex_count_ = 0;
+}
+
+void BatchRenderer::End()
+{
+    Flush();
+
+    frame_draw_calls_ = draw_calls_;
+    frame_vertex_count_ = vertex_count_;
+}
+
+void BatchRenderer::Flush()
+{
+    int vertices = positions_.size() / 2;
+    if (indices_.empty() || backend_ == nullptr)
+        return;
+
+    backend_->DrawTriangles(positions_.data(), colors_.data(), vertices, indices_.data(), indices_.size());
+
+    draw_calls_++;
+    vertex_count_ += vertices;
+
+    positions_.clear();
+    colors_.clear();
+    indices_.clear();
+}
+
+void BatchRenderer::SubmitPolygon(const Matrix &points, const RGBA &color)
+{
+    SubmitPolygon(points, color, AffineTransform::Identity());
+}
+
+void BatchRenderer::SubmitPolygon(const Matrix &points, const RGBA &color, const AffineTransform &transform)
+{
+    int count = points.get_rows();
+    if (count > 3 && points[count - 1][0] == points[0][0] && points[count - 1][1] == points[0][1])
+        count--;
+
+    const unsigned char *rgba = color.get_channels();
+    unsigned int first = positions_.size() / 2;
+    for (int i = 0; i < count; i++)
+    {
+        const Vector &point = points[i];
+        double x, y;
+        transform.Apply(point[0], point[1], x, y);
+        PushVertex(x, y, rgba);
+    }
+
+    PushFan(first, count);
+}
+
+void BatchRenderer::SubmitCircle(double x, double y, double radius, const RGBA &color)
+{
+    const unsigned char *rgba = color.get_channels();
+    const MeshTemplate &mesh = *SelectCircleTemplate(radius).mesh;
+    const double *unit_cos = mesh.get_xs();
+    const double *unit_sin = mesh.get_ys();
+
+    unsigned int first = positions_.size() / 2;
+    for (int i = 0; i < mesh.get_vertex_count(); i++)
+        PushVertex(x + radius * unit_cos[i], y + radius * unit_sin[i], rgba);
+
+    for (auto index : mesh.get_indices())
+        indices_.push_back(first + index);
+}
+
+void BatchRenderer::SubmitLine(double x0, double y0, double x1, double y1, double width, const RGBA &color)
+{
+    double length = std::hypot(x1 - x0, y1 - y0);
+    if (length == 0)
+        return;
+
+    double offset_x = -(y1 - y0) / length * width / 2;
+    double offset_y = (x1 - x0) / length * width / 2;
+
+    const unsigned char *rgba = color.get_channels();
+    unsigned int first = positions_.size() / 2;
+    PushVertex(x0 + offset_x, y0 + offset_y, rgba);
+    PushVertex(x1 + offset_x, y1 + offset_y, rgba);
+    PushVertex(x1 - offset_x, y1 - offset_y, rgba);
+    PushVertex(x0 - offset_x, y0 - offset_y, rgba);
+    PushFan(first, 4);
+}
+
+void BatchRenderer::SubmitMesh(const MeshTemplate &mesh, const RGBA &color, const AffineTransform &transform)
+{
+    const unsigned char *rgba = color.get_channels();
+    const double *xs = mesh.get_xs();
+    const double *ys = mesh.get_ys();
+
+    unsigned int first = positions_.size() / 2;
+    for (int i = 0; i < mesh.get_vertex_count(); i++)
+    {
+        double x, y;
+        transform.Apply(xs[i], ys[i], x, y);
+        PushVertex(x, y, rgba);
+    }
+
+    for (auto index : mesh.get_indices())
+        indices_.push_back(first + index);
+}
+
+void BatchRenderer::SubmitStaticMesh(const StaticMesh &mesh)
+{
+    if (mesh.IsEmpty() || backend_ == nullptr)
+        return;
+
+    Flush();
+    backend_->DrawStaticMesh(mesh);
+
+    draw_calls_++;
+    vertex_count_ += mesh.get_vertex_count();
+}
+
+void BatchRenderer::Bake(StaticMesh &mesh)
+{
+    mesh.Assign(positions_, colors_, indices_);
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void BatchRenderer::PushVertex(double x, double y, const unsigned char *color)
+{
+    positions_.push_back(static_cast<float>(x));
+    positions_.push_back(static_cast<float>(y));
+    colors_.insert(colors_.end(), color, color + 4);
+}
+
+void BatchRenderer::PushFan(unsigned int first, int count)
+{
+    for (int i = 1; i + 1 < count; i++)
+    {
+        indices_.push_back(first);
+        indices_.push_back(first + i);
+        indices_.push_back(first + i + 1);
+    }
+}
+
+const BatchRenderer::CircleTemplate &BatchRenderer::SelectCircleTemplate(double radius) const
+{
+    for (auto &level : circle_templates_)
+    {
+        if (radius <= level.max_radius)
+            return level;
+    }
+
+    return circle_templates_.back();
+}
+#pragma endregion // Private Methods
+
+#pragma region Getters and Setters
+void BatchRenderer::set_backend(IRenderBackend *backend)
+{
+    backend_ = backend;
+}
+
+void BatchRenderer::set_pixels_per_unit(double pixels_per_unit)
+{
+    // A chord spanning 2 * pi / n radians strays r * (1 - cos(pi / n)) from the circle.
+    for (auto &level : circle_templates_)
+        level.max_radius = circle_tolerance_ / (1 - std::cos(M_PI / level.segments)) / pixels_per_unit;
+}
+
+int BatchRenderer::get_circle_segments(double radius) const
+{
+    return SelectCircleTemplate(radius).segments;
+}
+
+int BatchRenderer::get_draw_calls() const
+{
+    return frame_draw_calls_;
+}
+
+int BatchRenderer::get_vertex_count() const
+{
+    return frame_vertex_count_;
+}
+#pragma endregion // Getters and Setters
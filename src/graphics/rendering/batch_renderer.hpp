@@ -0,0 +1,82 @@
+#pragma once
+
+#include <vector>
+
+#include "../../math/matrix.hpp"
+#include "../../math/affine_transform.hpp"
+#include "../color/rgba.hpp"
+#include "irender_backend.hpp"
+#include "mesh_template.hpp"
+#include "static_mesh.hpp"
+
+namespace graphics::rendering
+{
+    // Collects every shape of a frame as indexed colored triangles and hands them to the
+    // backend in a single draw. All geometry shares the same state (flat colored
+    // triangles), so submission order is kept and painter's order still holds.
+    class BatchRenderer
+    {
+    public:
+        BatchRenderer(int capacity = default_capacity_);
+        BatchRenderer(const BatchRenderer &other) = delete;
+        ~BatchRenderer() = default;
+
+        BatchRenderer &operator=(const BatchRenderer &other) = delete;
+
+        void Begin();
+        void End();
+        void Flush();
+
+        // Points are the outline of a convex polygon, triangulated as a fan. A closing point
+        // equal to the first one is ignored.
+        void SubmitPolygon(const math::Matrix &points, const color::RGBA &color);
+        void SubmitPolygon(const math::Matrix &points, const color::RGBA &color, const math::AffineTransform &transform);
+        // Circles get the fewest segments that keep the outline within circle_tolerance_
+        // pixels of the true circle, rounded up to one of the cached template levels.
+        void SubmitCircle(double x, double y, double radius, const color::RGBA &color);
+        // A segment drawn as a quad of the given width.
+        void SubmitLine(double x0, double y0, double x1, double y1, double width, const color::RGBA &color);
+        // Expands a shared template through the transform straight into the batch.
+        void SubmitMesh(const MeshTemplate &mesh, const color::RGBA &color, const math::AffineTransform &transform);
+        void SubmitStaticMesh(const StaticMesh &mesh);
+
+        // Moves everything submitted since Begin into the mesh instead of drawing it.
+        void Bake(StaticMesh &mesh);
+
+        void set_backend(IRenderBackend *backend);
+        // Screen scale used to pick circle detail; recomputes the level thresholds.
+        void set_pixels_per_unit(double pixels_per_unit);
+
+        int get_circle_segments(double radius) const;
+        int get_draw_calls() const;
+        int get_vertex_count() const;
+
+        inline static int default_capacity_ = 16384;
+        inline static double circle_tolerance_ = 0.25;
+
+    private:
+        struct CircleTemplate
+        {
+            int segments;
+            double max_radius;
+            const MeshTemplate *mesh;
+        };
+
+        IRenderBackend *backend_;
+
+        std::vector<float> positions_;
+        std::vector<unsigned char> colors_;
+        std::vector<unsigned int> indices_;
+
+        std::vector<CircleTemplate> circle_templates_;
+
+        int draw_calls_;
+        int vertex_count_;
+        int frame_draw_calls_;
+        int frame_vertex_count_;
+
+        void PushVertex(double x, double y, const unsigned char *color);
+        void PushFan(unsigned int first, int count);
+        const CircleTemplate &SelectCircleTemplate(double radius) const;
+    };
+}
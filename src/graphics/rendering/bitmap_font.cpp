@@ -0,0 +1,129 @@
+#include "bitmap_font.hpp"
+
+#include <cctype>
+#include <vector>
+
+using ::graphics::rendering::BitmapFont;
+using ::std::vector;
+
+namespace
+{
+    struct GlyphBitmap
+    {
+        char character;
+        // One byte per row, top first; bit 4 is the leftmost pixel.
+        unsigned char rows[7];
+    };
+
+    const GlyphBitmap kGlyphBitmaps[] = {
+        {'0', {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}},
+        {'1', {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+        {'2', {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}},
+        {'3', {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}},
+        {'4', {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}},
+        {'5', {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}},
+        {'6', {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}},
+        {'7', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}},
+        {'8', {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}},
+        {'9', {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}},
+        {'A', {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}},
+        {'B', {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}},
+        {'C', {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}},
+        {'D', {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}},
+        {'E', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}},
+        {'F', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}},
+        {'G', {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}},
+        {'H', {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}},
+        {'I', {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+        {'J', {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}},
+        {'K', {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}},
+        {'L', {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}},
+        {'M', {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}},
+        {'N', {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}},
+        {'O', {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+        {'P', {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}},
+        {'Q', {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}},
+        {'R', {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}},
+        {'S', {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}},
+        {'T', {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}},
+        {'U', {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+        {'V', {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}},
+        {'W', {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}},
+        {'X', {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}},
+        {'Y', {0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04}},
+        {'Z', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}},
+        {'.', {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}},
+        {':', {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}},
+        {'-', {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}},
+        {'/', {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}},
+        {'%', {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}},
+    };
+}
+
+#pragma region Public Methods
+const vector<BitmapFont::GlyphRect> &BitmapFont::get_glyph(char character)
+{
+    static const vector<vector<GlyphRect>> atlas = []
+    {
+        vector<vector<GlyphRect>> baked(128);
+        for (auto &bitmap : kGlyphBitmaps)
+            baked[bitmap.character] = Bake(bitmap.rows);
+        return baked;
+    }();
+
+    unsigned char index = std::toupper(static_cast<unsigned char>(character));
+    return index < atlas.size() ? atlas[index] : atlas[' '];
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+vector<BitmapFont::GlyphRect> BitmapFont::Bake(const unsigned char *rows)
+{
+    vector<GlyphRect> rects;
+    vector<GlyphRect> open;
+
+    for (int y = 0; y <= glyph_height_; y++)
+    {
+        vector<GlyphRect> runs;
+        for (int x = 0; y < glyph_height_ && x < glyph_width_; x++)
+        {
+            if ((rows[y] >> (glyph_width_ - 1 - x) & 1) == 0)
+                continue;
+
+            if (!runs.empty() && runs.back().x + runs.back().width == x)
+                runs.back().width++;
+            else
+                runs.push_back({x, y, 1, 1});
+        }
+
+        // A run identical to one on the row above extends that rectangle downwards.
+        vector<GlyphRect> next;
+        for (auto &run : runs)
+        {
+            bool extended = false;
+            for (auto &rect : open)
+            {
+                if (rect.width > 0 && rect.x == run.x && rect.width == run.width)
+                {
+                    rect.height++;
+                    next.push_back(rect);
+                    rect.width = 0;
+                    extended = true;
+                    break;
+                }
+            }
+            if (!extended)
+                next.push_back(run);
+        }
+
+        for (auto &rect : open)
+        {
+            if (rect.width > 0)
+                rects.push_back(rect);
+        }
+        open = next;
+    }
+
+    return rects;
+}
+#pragma endregion // Private Methods
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+
+namespace graphics::rendering
+{
+    // A 5x7 bitmap font baked once into rectangles: every glyph's lit pixels are merged
+    // into horizontal runs, and runs repeated on consecutive rows into one rectangle, so
+    // text becomes a handful of quads per character. Covers digits, letters (lowercase
+    // is drawn as uppercase) and . : - / %; anything else is blank.
+    class BitmapFont
+    {
+    public:
+        // In glyph pixels, y growing downwards from the top of the cell.
+        struct GlyphRect
+        {
+            int x;
+            int y;
+            int width;
+            int height;
+        };
+
+        static const std::vector<GlyphRect> &get_glyph(char character);
+
+        inline static const int glyph_width_ = 5;
+        inline static const int glyph_height_ = 7;
+        // Horizontal distance between the origins of two characters.
+        inline static const int advance_ = 6;
+
+    private:
+        static std::vector<GlyphRect> Bake(const unsigned char *rows);
+    };
+}
@@ -0,0 +1,86 @@
+#include "camera.hpp"
+
+using ::graphics::rendering::Camera;
+
+#pragma region Constructors and Destructors
+Camera::Camera()
+{
+    Reset(0, 0, 0, 0);
+    BeginFrame();
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+void Camera::Reset(double left, double top, double width, double height)
+{
+    left_ = left;
+    top_ = top;
+    width_ = width;
+    height_ = height;
+}
+
+void Camera::CenterOn(double x)
+{
+    left_ = x - width_ / 2;
+}
+
+bool Camera::IsVisible(double x, double y, double width, double height) const
+{
+    return x + width >= left_ - cull_margin_ && x <= left_ + width_ + cull_margin_ &&
+           y + height >= top_ - cull_margin_ && y <= top_ + height_ + cull_margin_;
+}
+
+void Camera::BeginFrame()
+{
+    visible_count_ = 0;
+    culled_count_ = 0;
+}
+
+void Camera::Count(int visible, int culled)
+{
+    visible_count_ += visible;
+    culled_count_ += culled;
+}
+#pragma endregion // Public Methods
+
+#pragma region Getters
+double Camera::get_left() const
+{
+    return left_;
+}
+
+double Camera::get_top() const
+{
+    return top_;
+}
+
+double Camera::get_right() const
+{
+    return left_ + width_;
+}
+
+double Camera::get_bottom() const
+{
+    return top_ + height_;
+}
+
+double Camera::get_width() const
+{
+    return width_;
+}
+
+double Camera::get_height() const
+{
+    return height_;
+}
+
+int Camera::get_visible_count() const
+{
+    return visible_count_;
+}
+
+int Camera::get_culled_count() const
+{
+    return culled_count_;
+}
+#pragma endregion // Getters
@@ -0,0 +1,41 @@
+#pragma once
+
+namespace graphics::rendering
+{
+    // The visible world rectangle. Renderers test against it, padded by the cull margin so
+    // parts hanging outside a bounding box are not clipped, and report what they kept.
+    class Camera
+    {
+    public:
+        Camera();
+
+        void Reset(double left, double top, double width, double height);
+        void CenterOn(double x);
+
+        bool IsVisible(double x, double y, double width, double height) const;
+
+        void BeginFrame();
+        void Count(int visible, int culled);
+
+        double get_left() const;
+        double get_top() const;
+        double get_right() const;
+        double get_bottom() const;
+        double get_width() const;
+        double get_height() const;
+
+        int get_visible_count() const;
+        int get_culled_count() const;
+
+        inline static double cull_margin_ = 10;
+
+    private:
+        double left_;
+        double top_;
+        double width_;
+        double height_;
+
+        int visible_count_;
+        int culled_count_;
+    };
+}
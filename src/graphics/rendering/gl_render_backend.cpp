@@ -0,0 +1,68 @@
+#include "gl_render_backend.hpp"
+
+#include <GL/glut.h>
+
+using ::graphics::color::RGBA;
+using ::graphics::rendering::GLRenderBackend;
+using ::graphics::rendering::StaticMesh;
+
+GLRenderBackend::~GLRenderBackend()
+{
+    for (auto &display_list : display_lists_)
+        glDeleteLists(display_list.second, 1);
+}
+
+void GLRenderBackend::SetClearColor(const RGBA &color)
+{
+    glClearColor(color.get_normalized_red(), color.get_normalized_green(), color.get_normalized_blue(), color.get_normalized_alpha());
+}
+
+void GLRenderBackend::SetProjection(double left, double right, double bottom, double top, double near, double far)
+{
+    glLoadIdentity();
+    glOrtho(left, right, bottom, top, near, far);
+}
+
+void GLRenderBackend::Translate(double dx, double dy)
+{
+    glTranslated(dx, dy, 0);
+}
+
+void GLRenderBackend::Clear()
+{
+    glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void GLRenderBackend::DrawTriangles(const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count)
+{
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, 0, positions);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, colors);
+
+    glDrawElements(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, indices);
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+void GLRenderBackend::DrawStaticMesh(const StaticMesh &mesh)
+{
+    auto it = display_lists_.find(mesh.get_id());
+    if (it == display_lists_.end())
+    {
+        unsigned int display_list = glGenLists(1);
+        glNewList(display_list, GL_COMPILE);
+        DrawTriangles(mesh.get_positions(), mesh.get_colors(), mesh.get_vertex_count(), mesh.get_indices(), mesh.get_index_count());
+        glEndList();
+
+        it = display_lists_.emplace(mesh.get_id(), display_list).first;
+    }
+
+    glCallList(it->second);
+}
+
+void GLRenderBackend::Present()
+{
+    glutSwapBuffers();
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "irender_backend.hpp"
+#include "static_mesh.hpp"
+#include "../color/rgba.hpp"
+
+#include <unordered_map>
+
+namespace graphics::rendering
+{
+    // Static meshes are compiled into display lists the first time they are drawn.
+    class GLRenderBackend : public IRenderBackend
+    {
+    public:
+        GLRenderBackend() = default;
+        ~GLRenderBackend();
+
+        void SetClearColor(const color::RGBA &color) override;
+        void SetProjection(double left, double right, double bottom, double top, double near, double far) override;
+        void Translate(double dx, double dy) override;
+        void Clear() override;
+        void DrawTriangles(const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count) override;
+        void DrawStaticMesh(const StaticMesh &mesh) override;
+        void Present() override;
+
+    private:
+        std::unordered_map<unsigned long, unsigned int> display_lists_;
+    };
+}
@@ -0,0 +1,123 @@
+#include "hud.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "bitmap_font.hpp"
+#include "irender_backend.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::rendering::BitmapFont;
+using ::graphics::rendering::Hud;
+using ::graphics::rendering::IRenderBackend;
+using ::std::string;
+
+#pragma region Constructors and Destructors
+Hud::Hud()
+{
+    visible_ = false;
+    dirty_ = true;
+    rebuild_count_ = 0;
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+void Hud::set_line(int index, const string &text)
+{
+    if (index >= (int)lines_.size())
+        lines_.resize(index + 1);
+
+    if (lines_[index] == text)
+        return;
+
+    lines_[index] = text;
+    dirty_ = true;
+}
+
+void Hud::Draw(IRenderBackend &backend, double width, double height)
+{
+    if (!visible_)
+        return;
+
+    if (dirty_)
+        Rebuild();
+
+    if (indices_.empty())
+        return;
+
+    backend.SetProjection(0, width, height, 0, -1, 1);
+    backend.DrawTriangles(positions_.data(), colors_.data(), positions_.size() / 2, indices_.data(), indices_.size());
+}
+
+void Hud::Toggle()
+{
+    visible_ = !visible_;
+}
+
+void Hud::set_visible(bool visible)
+{
+    visible_ = visible;
+}
+
+bool Hud::IsVisible() const
+{
+    return visible_;
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void Hud::Rebuild()
+{
+    positions_.clear();
+    colors_.clear();
+    indices_.clear();
+
+    size_t columns = 0;
+    for (auto &line : lines_)
+        columns = std::max(columns, line.size());
+
+    double line_height = (BitmapFont::glyph_height_ + line_spacing_) * pixel_size_;
+    double panel_width = columns * BitmapFont::advance_ * pixel_size_ + margin_ * 2;
+    double panel_height = lines_.size() * line_height + margin_ * 2;
+    if (columns > 0)
+        PushQuad(0, 0, panel_width, panel_height, panel_color_);
+
+    for (size_t row = 0; row < lines_.size(); row++)
+    {
+        double top = margin_ + row * line_height;
+        for (size_t column = 0; column < lines_[row].size(); column++)
+        {
+            double left = margin_ + column * BitmapFont::advance_ * pixel_size_;
+            for (auto &rect : BitmapFont::get_glyph(lines_[row][column]))
+                PushQuad(left + rect.x * pixel_size_, top + rect.y * pixel_size_, rect.width * pixel_size_, rect.height * pixel_size_, text_color_);
+        }
+    }
+
+    dirty_ = false;
+    rebuild_count_++;
+}
+
+void Hud::PushQuad(double x, double y, double width, double height, const RGBA &color)
+{
+    unsigned int first = positions_.size() / 2;
+    positions_.insert(positions_.end(), {(float)x, (float)y, (float)(x + width), (float)y, (float)(x + width), (float)(y + height), (float)x, (float)(y + height)});
+
+    const unsigned char *channels = color.get_channels();
+    for (int i = 0; i < 4; i++)
+        colors_.insert(colors_.end(), channels, channels + 4);
+
+    indices_.insert(indices_.end(), {first, first + 1, first + 2, first, first + 2, first + 3});
+}
+#pragma endregion // Private Methods
+
+#pragma region Getters
+int Hud::get_rebuild_count() const
+{
+    return rebuild_count_;
+}
+
+int Hud::get_vertex_count() const
+{
+    return positions_.size() / 2;
+}
+#pragma endregion // Getters
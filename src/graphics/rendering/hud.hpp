@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../color/rgba.hpp"
+#include "../color/palette.hpp"
+#include "irender_backend.hpp"
+
+namespace graphics::rendering
+{
+    // Lines of text drawn in window pixels over the finished frame. Glyphs come from the
+    // baked BitmapFont and the quads are rebuilt only when a line's text changes, so an
+    // unchanged overlay costs one draw of cached vertices.
+    class Hud
+    {
+    public:
+        Hud();
+
+        void set_line(int index, const std::string &text);
+        // Replaces the projection with window pixels, y growing downwards.
+        void Draw(IRenderBackend &backend, double width, double height);
+
+        void Toggle();
+        void set_visible(bool visible);
+        bool IsVisible() const;
+
+        int get_rebuild_count() const;
+        int get_vertex_count() const;
+
+        inline static double pixel_size_ = 2;
+        inline static double margin_ = 4;
+        inline static double line_spacing_ = 3;
+        inline static color::RGBA text_color_ = color::palette::kWhite;
+        inline static color::RGBA panel_color_ = color::palette::kBlack;
+
+    private:
+        std::vector<std::string> lines_;
+        bool visible_;
+        bool dirty_;
+        int rebuild_count_;
+
+        std::vector<float> positions_;
+        std::vector<unsigned char> colors_;
+        std::vector<unsigned int> indices_;
+
+        void Rebuild();
+        void PushQuad(double x, double y, double width, double height, const color::RGBA &color);
+    };
+}
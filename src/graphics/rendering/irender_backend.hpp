@@ -0,0 +1,27 @@
+#pragma once
+
+#include "../color/rgba.hpp"
+#include "static_mesh.hpp"
+
+namespace graphics::rendering
+{
+    // Everything the game asks of the graphics API. GLRenderBackend talks to OpenGL,
+    // RecordingRenderBackend only records what would have been drawn.
+    class IRenderBackend
+    {
+    public:
+        IRenderBackend() = default;
+        virtual ~IRenderBackend() = default;
+
+        virtual void SetClearColor(const color::RGBA &color) = 0;
+        virtual void SetProjection(double left, double right, double bottom, double top, double near, double far) = 0;
+        virtual void Translate(double dx, double dy) = 0;
+        virtual void Clear() = 0;
+
+        // Positions are x, y pairs and colors RGBA bytes, one per vertex.
+        virtual void DrawTriangles(const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count) = 0;
+        virtual void DrawStaticMesh(const StaticMesh &mesh) = 0;
+
+        virtual void Present() = 0;
+    };
+}
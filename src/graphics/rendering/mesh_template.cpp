@@ -0,0 +1,39 @@
+#include "mesh_template.hpp"
+
+#include <vector>
+
+using ::graphics::rendering::MeshTemplate;
+using ::std::vector;
+
+#pragma region Constructors and Destructors
+MeshTemplate::MeshTemplate(const vector<double> &xs, const vector<double> &ys)
+{
+    xs_ = xs;
+    ys_ = ys;
+
+    for (unsigned int i = 1; i + 1 < xs_.size(); i++)
+        indices_.insert(indices_.end(), {0u, i, i + 1});
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Getters
+int MeshTemplate::get_vertex_count() const
+{
+    return xs_.size();
+}
+
+const double *MeshTemplate::get_xs() const
+{
+    return xs_.data();
+}
+
+const double *MeshTemplate::get_ys() const
+{
+    return ys_.data();
+}
+
+const vector<unsigned int> &MeshTemplate::get_indices() const
+{
+    return indices_;
+}
+#pragma endregion // Getters
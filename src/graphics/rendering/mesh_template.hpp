@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+namespace graphics::rendering
+{
+    // An immutable convex outline in unit space, fan-triangulated once. Shapes share
+    // templates and keep only a transform; vertices are expanded when they are batched.
+    class MeshTemplate
+    {
+    public:
+        MeshTemplate(const std::vector<double> &xs, const std::vector<double> &ys);
+
+        int get_vertex_count() const;
+        const double *get_xs() const;
+        const double *get_ys() const;
+        const std::vector<unsigned int> &get_indices() const;
+
+    private:
+        std::vector<double> xs_;
+        std::vector<double> ys_;
+        std::vector<unsigned int> indices_;
+    };
+}
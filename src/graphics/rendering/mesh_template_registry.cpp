@@ -0,0 +1,63 @@
+#include "mesh_template_registry.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include "mesh_template.hpp"
+
+using ::graphics::rendering::MeshTemplate;
+using ::graphics::rendering::MeshTemplateRegistry;
+using ::std::vector;
+
+#pragma region Public Methods
+const MeshTemplate &MeshTemplateRegistry::get_unit_quad()
+{
+    static const MeshTemplate quad({0, 1, 1, 0}, {0, 0, 1, 1});
+    return quad;
+}
+
+const MeshTemplate &MeshTemplateRegistry::get_unit_circle(int segments)
+{
+    const vector<int> &levels = get_circle_levels();
+    const vector<MeshTemplate> &circles = get_unit_circles();
+
+    for (size_t i = 0; i < levels.size(); i++)
+    {
+        if (levels[i] >= segments)
+            return circles[i];
+    }
+
+    return circles.back();
+}
+
+const vector<int> &MeshTemplateRegistry::get_circle_levels()
+{
+    static const vector<int> levels = {6, 8, 12, 16, 24, 32};
+    return levels;
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+const vector<MeshTemplate> &MeshTemplateRegistry::get_unit_circles()
+{
+    static const vector<MeshTemplate> circles = []
+    {
+        vector<MeshTemplate> built;
+        for (int segments : get_circle_levels())
+        {
+            vector<double> xs;
+            vector<double> ys;
+            for (int i = 0; i < segments; i++)
+            {
+                double angle = 2 * M_PI * i / segments;
+                xs.push_back(std::cos(angle));
+                ys.push_back(std::sin(angle));
+            }
+            built.emplace_back(xs, ys);
+        }
+        return built;
+    }();
+
+    return circles;
+}
+#pragma endregion // Private Methods
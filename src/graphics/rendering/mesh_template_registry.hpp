@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+
+#include "mesh_template.hpp"
+
+namespace graphics::rendering
+{
+    // The process-wide templates every shape is drawn from. Built on first use and never
+    // changed afterwards, so they can be read from any thread.
+    class MeshTemplateRegistry
+    {
+    public:
+        // Corners (0, 0), (1, 0), (1, 1) and (0, 1).
+        static const MeshTemplate &get_unit_quad();
+        // Unit circle around the origin from the first level with at least the given
+        // number of segments, or the finest level.
+        static const MeshTemplate &get_unit_circle(int segments);
+        // Ascending segment counts of the cached circles.
+        static const std::vector<int> &get_circle_levels();
+
+    private:
+        static const std::vector<MeshTemplate> &get_unit_circles();
+    };
+}
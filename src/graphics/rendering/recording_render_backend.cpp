@@ -0,0 +1,161 @@
+#include "recording_render_backend.hpp"
+
+using ::graphics::color::RGBA;
+using ::graphics::rendering::IRenderBackend;
+using ::graphics::rendering::RecordingRenderBackend;
+using ::graphics::rendering::RenderCommand;
+using ::graphics::rendering::RenderCommandType;
+using ::graphics::rendering::StaticMesh;
+
+#pragma region Constructors and Destructors
+RecordingRenderBackend::RecordingRenderBackend(bool capture_geometry)
+{
+    capture_geometry_ = capture_geometry;
+    Reset();
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+void RecordingRenderBackend::SetClearColor(const RGBA &color)
+{
+    Record(RenderCommandType::kSetClearColor);
+    state_change_count_++;
+}
+
+void RecordingRenderBackend::SetProjection(double left, double right, double bottom, double top, double near, double far)
+{
+    Record(RenderCommandType::kSetProjection);
+    state_change_count_++;
+}
+
+void RecordingRenderBackend::Translate(double dx, double dy)
+{
+    Record(RenderCommandType::kTranslate);
+    state_change_count_++;
+}
+
+void RecordingRenderBackend::Clear()
+{
+    Record(RenderCommandType::kClear);
+}
+
+void RecordingRenderBackend::DrawTriangles(const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count)
+{
+    RecordDraw(RenderCommandType::kDrawTriangles, positions, colors, vertex_count, indices, index_count);
+}
+
+void RecordingRenderBackend::DrawStaticMesh(const StaticMesh &mesh)
+{
+    commands_.push_back({RenderCommandType::kDrawStaticMesh, 0, mesh.get_vertex_count(), 0, mesh.get_index_count(), &mesh});
+
+    draw_count_++;
+    vertex_count_ += mesh.get_vertex_count();
+    triangle_count_ += mesh.get_index_count() / 3;
+}
+
+void RecordingRenderBackend::Present()
+{
+    Record(RenderCommandType::kPresent);
+    frame_count_++;
+}
+
+void RecordingRenderBackend::Reset()
+{
+    commands_.clear();
+    positions_.clear();
+    colors_.clear();
+    indices_.clear();
+
+    frame_count_ = 0;
+    draw_count_ = 0;
+    state_change_count_ = 0;
+    vertex_count_ = 0;
+    triangle_count_ = 0;
+}
+
+void RecordingRenderBackend::Replay(IRenderBackend &backend) const
+{
+    for (auto &command : commands_)
+    {
+        if (command.type == RenderCommandType::kDrawStaticMesh)
+            backend.DrawStaticMesh(*command.mesh);
+        else if (command.type == RenderCommandType::kDrawTriangles && capture_geometry_)
+            backend.DrawTriangles(positions_.data() + command.first_vertex * 2, colors_.data() + command.first_vertex * 4, command.vertex_count, indices_.data() + command.first_index, command.index_count);
+    }
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void RecordingRenderBackend::Record(RenderCommandType type)
+{
+    commands_.push_back({type, 0, 0, 0, 0, nullptr});
+}
+
+void RecordingRenderBackend::RecordDraw(RenderCommandType type, const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count)
+{
+    RenderCommand command = {type, 0, vertex_count, 0, index_count, nullptr};
+
+    if (capture_geometry_)
+    {
+        command.first_vertex = positions_.size() / 2;
+        command.first_index = indices_.size();
+
+        positions_.insert(positions_.end(), positions, positions + vertex_count * 2);
+        colors_.insert(colors_.end(), colors, colors + vertex_count * 4);
+        indices_.insert(indices_.end(), indices, indices + index_count);
+    }
+
+    commands_.push_back(command);
+
+    draw_count_++;
+    vertex_count_ += vertex_count;
+    triangle_count_ += index_count / 3;
+}
+#pragma endregion // Private Methods
+
+#pragma region Getters
+const std::vector<RenderCommand> &RecordingRenderBackend::get_commands() const
+{
+    return commands_;
+}
+
+const std::vector<float> &RecordingRenderBackend::get_positions() const
+{
+    return positions_;
+}
+
+const std::vector<unsigned char> &RecordingRenderBackend::get_colors() const
+{
+    return colors_;
+}
+
+const std::vector<unsigned int> &RecordingRenderBackend::get_indices() const
+{
+    return indices_;
+}
+
+int RecordingRenderBackend::get_frame_count() const
+{
+    return frame_count_;
+}
+
+int RecordingRenderBackend::get_draw_count() const
+{
+    return draw_count_;
+}
+
+int RecordingRenderBackend::get_state_change_count() const
+{
+    return state_change_count_;
+}
+
+long RecordingRenderBackend::get_vertex_count() const
+{
+    return vertex_count_;
+}
+
+long RecordingRenderBackend::get_triangle_count() const
+{
+    return triangle_count_;
+}
+#pragma endregion // Getters
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+
+#include "irender_backend.hpp"
+#include "render_command.hpp"
+#include "static_mesh.hpp"
+#include "../color/rgba.hpp"
+
+namespace graphics::rendering
+{
+    // Headless backend: appends every call to a command buffer, copying geometry when
+    // capture is enabled, so frame building can be measured without a display.
+    class RecordingRenderBackend : public IRenderBackend
+    {
+    public:
+        RecordingRenderBackend(bool capture_geometry = true);
+        ~RecordingRenderBackend() = default;
+
+        void SetClearColor(const color::RGBA &color) override;
+        void SetProjection(double left, double right, double bottom, double top, double near, double far) override;
+        void Translate(double dx, double dy) override;
+        void Clear() override;
+        void DrawTriangles(const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count) override;
+        void DrawStaticMesh(const StaticMesh &mesh) override;
+        void Present() override;
+
+        void Reset();
+        // Issues the recorded draws on another backend. Triangle draws are skipped unless
+        // geometry was captured; state changes, clears and presents are left to the caller.
+        void Replay(IRenderBackend &backend) const;
+
+        const std::vector<RenderCommand> &get_commands() const;
+        const std::vector<float> &get_positions() const;
+        const std::vector<unsigned char> &get_colors() const;
+        const std::vector<unsigned int> &get_indices() const;
+
+        int get_frame_count() const;
+        int get_draw_count() const;
+        int get_state_change_count() const;
+        long get_vertex_count() const;
+        long get_triangle_count() const;
+
+    private:
+        bool capture_geometry_;
+
+        std::vector<RenderCommand> commands_;
+        std::vector<float> positions_;
+        std::vector<unsigned char> colors_;
+        std::vector<unsigned int> indices_;
+
+        int frame_count_;
+        int draw_count_;
+        int state_change_count_;
+        long vertex_count_;
+        long triangle_count_;
+
+        void Record(RenderCommandType type);
+        void RecordDraw(RenderCommandType type, const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count);
+    };
+}
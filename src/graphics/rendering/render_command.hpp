@@ -0,0 +1,29 @@
+#pragma once
+
+#include "static_mesh.hpp"
+
+namespace graphics::rendering
+{
+    enum class RenderCommandType
+    {
+        kSetClearColor,
+        kSetProjection,
+        kTranslate,
+        kClear,
+        kDrawTriangles,
+        kDrawStaticMesh,
+        kPresent
+    };
+
+    // Triangle draws point into the recording backend's geometry buffers. Static meshes
+    // outlive any frame, so they are referenced instead of copied.
+    struct RenderCommand
+    {
+        RenderCommandType type;
+        int first_vertex;
+        int vertex_count;
+        int first_index;
+        int index_count;
+        const StaticMesh *mesh;
+    };
+}
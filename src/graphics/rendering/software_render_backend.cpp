@@ -0,0 +1,330 @@
+#include "software_render_backend.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using ::graphics::color::RGBA;
+using ::graphics::rendering::SoftwareRenderBackend;
+using ::graphics::rendering::StaticMesh;
+using ::std::lock_guard;
+using ::std::max;
+using ::std::min;
+using ::std::mutex;
+using ::std::string;
+using ::std::uint32_t;
+using ::std::unique_lock;
+
+#pragma region Constructors and Destructors
+SoftwareRenderBackend::SoftwareRenderBackend(int width, int height, int thread_count)
+{
+    width_ = width;
+    height_ = height;
+    tiles_x_ = (width + tile_size_ - 1) / tile_size_;
+    tiles_y_ = (height + tile_size_ - 1) / tile_size_;
+    frame_count_ = 0;
+
+    pixels_.assign(width * height, 0);
+    bins_.resize(tiles_x_ * tiles_y_);
+    clear_color_ = 0;
+    clear_pending_ = false;
+
+    SetProjection(0, width, height, 0, -1, 1);
+
+    generation_ = 0;
+    busy_workers_ = 0;
+    stopping_ = false;
+    next_tile_ = 0;
+
+    if (thread_count <= 0)
+        thread_count = max(1u, std::thread::hardware_concurrency());
+    for (int i = 1; i < thread_count; i++)
+        workers_.emplace_back(&SoftwareRenderBackend::WorkerLoop, this);
+}
+
+SoftwareRenderBackend::~SoftwareRenderBackend()
+{
+    {
+        lock_guard<mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_ready_.notify_all();
+
+    for (auto &worker : workers_)
+        worker.join();
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+void SoftwareRenderBackend::SetClearColor(const RGBA &color)
+{
+    clear_color_ = color.get_packed();
+}
+
+// Same mapping as glOrtho followed by the viewport transform, with row 0 at the top.
+void SoftwareRenderBackend::SetProjection(double left, double right, double bottom, double top, double near, double far)
+{
+    scale_x_ = width_ / (right - left);
+    scale_y_ = height_ / (bottom - top);
+    offset_x_ = -left * scale_x_;
+    offset_y_ = -top * scale_y_;
+}
+
+void SoftwareRenderBackend::Translate(double dx, double dy)
+{
+    offset_x_ += dx * scale_x_;
+    offset_y_ += dy * scale_y_;
+}
+
+void SoftwareRenderBackend::Clear()
+{
+    triangles_.clear();
+    for (auto &bin : bins_)
+        bin.clear();
+    clear_pending_ = true;
+}
+
+void SoftwareRenderBackend::DrawTriangles(const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count)
+{
+    for (int i = 0; i + 2 < index_count; i += 3)
+    {
+        unsigned int v0 = indices[i];
+        unsigned int v1 = indices[i + 1];
+        unsigned int v2 = indices[i + 2];
+
+        Bin(positions[v0 * 2] * scale_x_ + offset_x_, positions[v0 * 2 + 1] * scale_y_ + offset_y_,
+            positions[v1 * 2] * scale_x_ + offset_x_, positions[v1 * 2 + 1] * scale_y_ + offset_y_,
+            positions[v2 * 2] * scale_x_ + offset_x_, positions[v2 * 2 + 1] * scale_y_ + offset_y_,
+            Pack(&colors[v0 * 4]));
+    }
+}
+
+void SoftwareRenderBackend::DrawStaticMesh(const StaticMesh &mesh)
+{
+    DrawTriangles(mesh.get_positions(), mesh.get_colors(), mesh.get_vertex_count(), mesh.get_indices(), mesh.get_index_count());
+}
+
+void SoftwareRenderBackend::Present()
+{
+    Resolve();
+    frame_count_++;
+}
+
+void SoftwareRenderBackend::Resolve()
+{
+    if (triangles_.empty() && !clear_pending_)
+        return;
+
+    next_tile_ = 0;
+    {
+        lock_guard<mutex> lock(mutex_);
+        generation_++;
+        busy_workers_ = workers_.size();
+    }
+    work_ready_.notify_all();
+
+    RasterizeTiles();
+
+    {
+        unique_lock<mutex> lock(mutex_);
+        work_done_.wait(lock, [this] { return busy_workers_ == 0; });
+    }
+
+    triangles_.clear();
+    for (auto &bin : bins_)
+        bin.clear();
+    clear_pending_ = false;
+}
+
+bool SoftwareRenderBackend::WritePPM(const string &path) const
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    file << "P6\n" << width_ << " " << height_ << "\n255\n";
+
+    std::vector<unsigned char> row(width_ * 3);
+    const unsigned char *pixels = get_pixels();
+    for (int y = 0; y < height_; y++)
+    {
+        for (int x = 0; x < width_; x++)
+        {
+            const unsigned char *pixel = &pixels[(y * width_ + x) * 4];
+            row[x * 3] = pixel[0];
+            row[x * 3 + 1] = pixel[1];
+            row[x * 3 + 2] = pixel[2];
+        }
+        file.write(reinterpret_cast<const char *>(row.data()), row.size());
+    }
+
+    return static_cast<bool>(file);
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+void SoftwareRenderBackend::Bin(float x0, float y0, float x1, float y1, float x2, float y2, uint32_t color)
+{
+    float area = (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        std::swap(x1, x2);
+        std::swap(y1, y2);
+    }
+
+    float min_x = min(x0, min(x1, x2));
+    float max_x = max(x0, max(x1, x2));
+    float min_y = min(y0, min(y1, y2));
+    float max_y = max(y0, max(y1, y2));
+    if (max_x < 0 || max_y < 0 || min_x >= width_ || min_y >= height_)
+        return;
+
+    Triangle triangle;
+    float xs[3] = {x0, x1, x2};
+    float ys[3] = {y0, y1, y2};
+    for (int i = 0; i < 3; i++)
+    {
+        int j = (i + 1) % 3;
+        triangle.a[i] = ys[i] - ys[j];
+        triangle.c[i] = xs[j] - xs[i];
+        triangle.d[i] = (ys[j] - ys[i]) * xs[i] - (xs[j] - xs[i]) * ys[i];
+    }
+    triangle.min_y = min_y;
+    triangle.max_y = max_y;
+    triangle.color = color;
+
+    unsigned int index = triangles_.size();
+    triangles_.push_back(triangle);
+
+    int first_tile_x = static_cast<int>(max(min_x, 0.0f)) / tile_size_;
+    int last_tile_x = static_cast<int>(min(max_x, width_ - 1.0f)) / tile_size_;
+    int first_tile_y = static_cast<int>(max(min_y, 0.0f)) / tile_size_;
+    int last_tile_y = static_cast<int>(min(max_y, height_ - 1.0f)) / tile_size_;
+
+    for (int tile_y = first_tile_y; tile_y <= last_tile_y; tile_y++)
+        for (int tile_x = first_tile_x; tile_x <= last_tile_x; tile_x++)
+            bins_[tile_y * tiles_x_ + tile_x].push_back(index);
+}
+
+void SoftwareRenderBackend::WorkerLoop()
+{
+    unsigned long seen_generation = 0;
+
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(mutex_);
+            work_ready_.wait(lock, [this, seen_generation] { return stopping_ || generation_ != seen_generation; });
+            if (stopping_)
+                return;
+            seen_generation = generation_;
+        }
+
+        RasterizeTiles();
+
+        {
+            lock_guard<mutex> lock(mutex_);
+            if (--busy_workers_ == 0)
+                work_done_.notify_one();
+        }
+    }
+}
+
+void SoftwareRenderBackend::RasterizeTiles()
+{
+    int tile_count = tiles_x_ * tiles_y_;
+    for (int tile = next_tile_++; tile < tile_count; tile = next_tile_++)
+        RasterizeTile(tile);
+}
+
+void SoftwareRenderBackend::RasterizeTile(int tile)
+{
+    int begin_x = (tile % tiles_x_) * tile_size_;
+    int begin_y = (tile / tiles_x_) * tile_size_;
+    int end_x = min(width_, begin_x + tile_size_);
+    int end_y = min(height_, begin_y + tile_size_);
+
+    if (clear_pending_)
+    {
+        for (int y = begin_y; y < end_y; y++)
+            std::fill(&pixels_[y * width_ + begin_x], &pixels_[y * width_ + end_x], clear_color_);
+    }
+
+    for (auto index : bins_[tile])
+    {
+        const Triangle &triangle = triangles_[index];
+
+        // Pixel centers sit at +0.5; rows and columns are the ones whose center is covered.
+        int first_y = static_cast<int>(std::ceil(max(triangle.min_y, static_cast<float>(begin_y)) - 0.5f));
+        int last_y = static_cast<int>(std::floor(min(triangle.max_y, static_cast<float>(end_y)) - 0.5f));
+
+        for (int y = first_y; y <= last_y; y++)
+        {
+            float center_y = y + 0.5f;
+            float low = begin_x + 0.5f;
+            float high = end_x - 0.5f;
+
+            for (int i = 0; i < 3; i++)
+            {
+                float offset = triangle.c[i] * center_y + triangle.d[i];
+                if (triangle.a[i] > 0)
+                    low = max(low, -offset / triangle.a[i]);
+                else if (triangle.a[i] < 0)
+                    high = min(high, -offset / triangle.a[i]);
+                else if (offset < 0)
+                    high = low - 1;
+            }
+
+            int first_x = static_cast<int>(std::ceil(low - 0.5f));
+            int last_x = static_cast<int>(std::floor(high - 0.5f));
+            if (first_x > last_x)
+                continue;
+
+            // A plain fill over a contiguous span, which the compiler turns into vector stores.
+            uint32_t *row = &pixels_[y * width_];
+            std::fill(row + first_x, row + last_x + 1, triangle.color);
+        }
+    }
+}
+
+uint32_t SoftwareRenderBackend::Pack(const unsigned char *rgba)
+{
+    uint32_t pixel;
+    std::memcpy(&pixel, rgba, sizeof(pixel));
+    return pixel;
+}
+#pragma endregion // Private Methods
+
+#pragma region Getters
+int SoftwareRenderBackend::get_width() const
+{
+    return width_;
+}
+
+int SoftwareRenderBackend::get_height() const
+{
+    return height_;
+}
+
+int SoftwareRenderBackend::get_thread_count() const
+{
+    return workers_.size() + 1;
+}
+
+int SoftwareRenderBackend::get_frame_count() const
+{
+    return frame_count_;
+}
+
+const unsigned char *SoftwareRenderBackend::get_pixels() const
+{
+    return reinterpret_cast<const unsigned char *>(pixels_.data());
+}
+#pragma endregion // Getters
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "irender_backend.hpp"
+#include "static_mesh.hpp"
+#include "../color/rgba.hpp"
+
+namespace graphics::rendering
+{
+    // CPU rasterizer for machines without a GPU or a display. Draws are transformed to
+    // pixels and binned into square tiles as they arrive; Present rasterizes the tiles in
+    // parallel, each one walking its triangles in submission order and filling whole
+    // spans, so painter's order holds without any locking. Triangles are flat shaded with
+    // the color of their first vertex and written opaque, as the game only draws
+    // flat-colored shapes.
+    class SoftwareRenderBackend : public IRenderBackend
+    {
+    public:
+        // A thread count of zero uses every hardware thread; the caller's thread is one of them.
+        SoftwareRenderBackend(int width, int height, int thread_count = 0);
+        SoftwareRenderBackend(const SoftwareRenderBackend &other) = delete;
+        ~SoftwareRenderBackend();
+
+        SoftwareRenderBackend &operator=(const SoftwareRenderBackend &other) = delete;
+
+        void SetClearColor(const color::RGBA &color) override;
+        void SetProjection(double left, double right, double bottom, double top, double near, double far) override;
+        void Translate(double dx, double dy) override;
+        void Clear() override;
+        void DrawTriangles(const float *positions, const unsigned char *colors, int vertex_count, const unsigned int *indices, int index_count) override;
+        void DrawStaticMesh(const StaticMesh &mesh) override;
+        void Present() override;
+
+        // Rasterizes everything drawn since the last resolve into the framebuffer.
+        void Resolve();
+        // Binary PPM of the framebuffer, top row first.
+        bool WritePPM(const std::string &path) const;
+
+        int get_width() const;
+        int get_height() const;
+        int get_thread_count() const;
+        int get_frame_count() const;
+        // RGBA bytes, row by row from the top.
+        const unsigned char *get_pixels() const;
+
+        inline static int tile_size_ = 64;
+
+    private:
+        // Edge i is inside where a[i] * x + c[i] * y + d[i] >= 0, at pixel centers.
+        struct Triangle
+        {
+            float a[3];
+            float c[3];
+            float d[3];
+            float min_y;
+            float max_y;
+            std::uint32_t color;
+        };
+
+        int width_;
+        int height_;
+        int tiles_x_;
+        int tiles_y_;
+        int frame_count_;
+
+        std::vector<std::uint32_t> pixels_;
+        std::vector<Triangle> triangles_;
+        std::vector<std::vector<unsigned int>> bins_;
+        std::uint32_t clear_color_;
+        bool clear_pending_;
+
+        double scale_x_;
+        double scale_y_;
+        double offset_x_;
+        double offset_y_;
+
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable work_ready_;
+        std::condition_variable work_done_;
+        unsigned long generation_;
+        int busy_workers_;
+        bool stopping_;
+        std::atomic<int> next_tile_;
+
+        void Bin(float x0, float y0, float x1, float y1, float x2, float y2, std::uint32_t color);
+        void WorkerLoop();
+        void RasterizeTiles();
+        void RasterizeTile(int tile);
+
+        static std::uint32_t Pack(const unsigned char *rgba);
+    };
+}
@@ -0,0 +1,72 @@
+#include "static_mesh.hpp"
+
+using ::graphics::rendering::StaticMesh;
+
+#pragma region Constructors and Destructors
+StaticMesh::StaticMesh()
+{
+    id_ = next_id_++;
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+// Takes the contents of the given arrays, leaving them empty.
+void StaticMesh::Assign(std::vector<float> &positions, std::vector<unsigned char> &colors, std::vector<unsigned int> &indices)
+{
+    positions_.swap(positions);
+    colors_.swap(colors);
+    indices_.swap(indices);
+
+    positions.clear();
+    colors.clear();
+    indices.clear();
+
+    id_ = next_id_++;
+}
+
+void StaticMesh::Clear()
+{
+    positions_.clear();
+    colors_.clear();
+    indices_.clear();
+
+    id_ = next_id_++;
+}
+
+bool StaticMesh::IsEmpty() const
+{
+    return indices_.empty();
+}
+#pragma endregion // Public Methods
+
+#pragma region Getters
+unsigned long StaticMesh::get_id() const
+{
+    return id_;
+}
+
+int StaticMesh::get_vertex_count() const
+{
+    return positions_.size() / 2;
+}
+
+int StaticMesh::get_index_count() const
+{
+    return indices_.size();
+}
+
+const float *StaticMesh::get_positions() const
+{
+    return positions_.data();
+}
+
+const unsigned char *StaticMesh::get_colors() const
+{
+    return colors_.data();
+}
+
+const unsigned int *StaticMesh::get_indices() const
+{
+    return indices_.data();
+}
+#pragma endregion // Getters
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+
+namespace graphics::rendering
+{
+    // Geometry that never changes once built. Backends may upload it once and replay it,
+    // keyed by the id, which is unique for every mesh and every rebuild.
+    class StaticMesh
+    {
+    public:
+        StaticMesh();
+        StaticMesh(const StaticMesh &other) = delete;
+        ~StaticMesh() = default;
+
+        StaticMesh &operator=(const StaticMesh &other) = delete;
+
+        void Assign(std::vector<float> &positions, std::vector<unsigned char> &colors, std::vector<unsigned int> &indices);
+        void Clear();
+        bool IsEmpty() const;
+
+        unsigned long get_id() const;
+        int get_vertex_count() const;
+        int get_index_count() const;
+        const float *get_positions() const;
+        const unsigned char *get_colors() const;
+        const unsigned int *get_indices() const;
+
+    private:
+        unsigned long id_;
+
+        std::vector<float> positions_;
+        std::vector<unsigned char> colors_;
+        std::vector<unsigned int> indices_;
+
+        static inline unsigned long next_id_ = 1;
+    };
+}
@@ -2,85 +2,84 @@
 
 #include <cmath>
 
+#include "./../rendering/mesh_template_registry.hpp"
+
 using ::graphics::color::RGBA;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::MeshTemplateRegistry;
 using ::graphics::shapes::Circle;
-using ::math::Matrix;
+using ::math::AffineTransform;
 using ::math::Vector;
 
 #pragma region Constructor and Destructor
 Circle::Circle()
-    : Model2D()
+    : Model2D(MeshTemplateRegistry::get_unit_circle(segments_), Place(Vector::Zero(2), 0))
 {
-    color_ = RGBA();
     radius_ = 0;
-    angle_ = 0;
-    BuildPoints(Vector::Zero(2), 0);
 }
 
 Circle::Circle(const Vector &origin, double radius)
-    : Model2D()
+    : Model2D(MeshTemplateRegistry::get_unit_circle(segments_), Place(origin, radius))
 {
-    color_ = RGBA();
     radius_ = radius;
-    BuildPoints(origin, radius);
 }
 
 Circle::Circle(const Vector &origin, double radius, const RGBA &color)
-    : Model2D()
+    : Model2D(MeshTemplateRegistry::get_unit_circle(segments_), Place(origin, radius), color)
 {
-    color_ = color;
     radius_ = radius;
-    BuildPoints(origin, radius);
 }
 
 Circle::Circle(const Circle &other)
     : Model2D(other)
 {
-    points_ = other.points_;
     radius_ = other.radius_;
-    color_ = other.color_;
 }
 
 Circle::Circle(const Circle &&other)
     : Model2D(other)
 {
-    points_ = other.points_;
     radius_ = other.radius_;
-    color_ = other.color_;
 }
 #pragma endregion // Constructor and Destructor
 
 #pragma region Operator Overloads
 Circle &Circle::operator=(const Circle &other)
 {
-    points_ = other.points_;
-    color_ = other.color_;
+    Model2D::operator=(other);
     radius_ = other.radius_;
     return *this;
 }
 
 Circle &Circle::operator=(const Circle &&other)
 {
-    points_ = other.points_;
-    color_ = other.color_;
+    Model2D::operator=(other);
     radius_ = other.radius_;
     return *this;
 }
 #pragma endregion // Operator Overloads
 
+#pragma region Public Methods
+void Circle::Draw(BatchRenderer &renderer)
+{
+    Draw(renderer, AffineTransform::Identity());
+}
+
+void Circle::Draw(BatchRenderer &renderer, const AffineTransform &transform)
+{
+    AffineTransform placement = transform * transform_;
+    double x, y, edge_x, edge_y;
+    placement.Apply(0, 0, x, y);
+    placement.Apply(1, 0, edge_x, edge_y);
+
+    renderer.SubmitCircle(x, y, std::hypot(edge_x - x, edge_y - y), color_);
+}
+#pragma endregion // Public Methods
+
 #pragma region Private Methods
-void Circle::BuildPoints(const Vector &origin, double radius)
+AffineTransform Circle::Place(const Vector &origin, double radius)
 {
-    points_ = Matrix::Zero(segments_ + 1, 2);
-    double angle = 0;
-    for (int i = 0; i < segments_; i++)
-    {
-        points_[i][0] = origin[0] + radius * std::cos(angle);
-        points_[i][1] = origin[1] + radius * std::sin(angle);
-        angle += 2 * M_PI / segments_;
-    }
-    points_[segments_][0] = points_[0][0];
-    points_[segments_][1] = points_[0][1];
+    return AffineTransform::Translation(origin[0], origin[1]) * AffineTransform::Scale(radius, radius);
 }
 #pragma endregion // Private Methods
 
@@ -91,5 +90,5 @@ double Circle::get_radius() const
 
 Vector Circle::get_center_position() const
 {
-    return (points_[0] + points_[8] + points_[16] + points_[24]) / 4;
-}
\ No newline at end of file
+    return transform_.Apply(Vector::Zero(2));
+}
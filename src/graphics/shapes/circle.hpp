@@ -17,15 +17,20 @@ namespace graphics::shapes
         Circle &operator=(const Circle &other);
         Circle &operator=(const Circle &&other);
 
+        // Drawn through the renderer's circle path so the detail follows the on-screen size.
+        void Draw(graphics::rendering::BatchRenderer &renderer) override;
+        void Draw(graphics::rendering::BatchRenderer &renderer, const math::AffineTransform &transform) override;
+
         double get_radius() const;
         math::Vector get_center_position() const override;
 
     protected:
         double radius_;
 
-        void BuildPoints(const math::Vector &origin, double radius);
-
     private:
-        static inline double segments_ = 32;
+        static math::AffineTransform Place(const math::Vector &origin, double radius);
+
+        // Detail of the outline returned by get_points; drawing picks its own level.
+        static inline int segments_ = 32;
     };
 }
@@ -6,31 +6,21 @@ using ::graphics::shapes::Model;
 #pragma region Constructors and Destructors
 Model::Model()
 {
-    points_ = math::Matrix(0, 0);
     color_ = RGBA();
 }
 
-Model::Model(const math::Matrix &matrix)
+Model::Model(const RGBA &color)
 {
-    points_ = matrix;
-    color_ = RGBA();
-}
-
-Model::Model(const math::Matrix &matrix, const RGBA &color)
-{
-    points_ = matrix;
     color_ = color;
 }
 
 Model::Model(const Model &other)
 {
-    points_ = other.points_;
     color_ = other.color_;
 }
 
 Model::Model(const Model &&other)
 {
-    points_ = other.points_;
     color_ = other.color_;
 }
 #pragma endregion // Constructors and Destructors
@@ -40,7 +30,6 @@ Model &Model::operator=(const Model &other)
 {
     if (this != &other)
     {
-        points_ = other.points_;
         color_ = other.color_;
     }
     return *this;
@@ -50,9 +39,15 @@ Model &Model::operator=(const Model &&other)
 {
     if (this != &other)
     {
-        points_ = other.points_;
         color_ = other.color_;
     }
     return *this;
 }
-#pragma endregion // Operators
\ No newline at end of file
+#pragma endregion // Operators
+
+#pragma region Getters
+const RGBA &Model::get_color() const
+{
+    return color_;
+}
+#pragma endregion // Getters
\ No newline at end of file
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "./../../math/matrix.hpp"
+#include "./../../math/affine_transform.hpp"
 #include "./../color/rgba.hpp"
+#include "./../rendering/batch_renderer.hpp"
 
 namespace graphics::shapes
 {
@@ -9,8 +11,7 @@ namespace graphics::shapes
     {
     public:
         Model();
-        Model(const math::Matrix &matrix);
-        Model(const math::Matrix &matrix, const graphics::color::RGBA &color);
+        Model(const graphics::color::RGBA &color);
         Model(const Model &other);
         Model(const Model &&other);
         virtual ~Model() = default;
@@ -24,10 +25,14 @@ namespace graphics::shapes
         virtual void Transform(const math::Matrix &matrix) = 0;
         virtual void Transform(const math::Vector &center, const math::Vector &scale, double radians) = 0;
 
-        virtual void Draw() = 0;
+        virtual void Draw(graphics::rendering::BatchRenderer &renderer) = 0;
+        virtual void Draw(graphics::rendering::BatchRenderer &renderer, const math::AffineTransform &transform) = 0;
+
+        // Outline in world space, expanded on demand; shapes only store how to build it.
+        virtual math::Matrix get_points() const = 0;
+        const color::RGBA &get_color() const;
 
     protected:
-        math::Matrix points_;
         color::RGBA color_;
     };
 }
\ No newline at end of file
@@ -4,10 +4,14 @@
 #include <stdexcept>
 #include <cmath>
 
-#include <GL/glut.h>
+#include "./../rendering/mesh_template_registry.hpp"
 
 using ::graphics::color::RGBA;
+using ::graphics::rendering::BatchRenderer;
+using ::graphics::rendering::MeshTemplate;
+using ::graphics::rendering::MeshTemplateRegistry;
 using ::graphics::shapes::Model2D;
+using ::math::AffineTransform;
 using ::math::Matrix;
 using ::math::Vector;
 using ::std::cout;
@@ -17,40 +21,64 @@ using ::std::endl;
 Model2D::Model2D()
     : Model()
 {
+    mesh_ = &MeshTemplateRegistry::get_unit_quad();
+    transform_ = AffineTransform::Scale(0, 0);
     angle_ = 0;
 }
 
-Model2D::Model2D(const Matrix &matrix)
-    : Model(matrix)
+Model2D::Model2D(const MeshTemplate &mesh, const AffineTransform &transform)
+    : Model()
 {
+    mesh_ = &mesh;
+    transform_ = transform;
     angle_ = 0;
-    ValidateMatrix(points_);
 }
 
-Model2D::Model2D(const Matrix &matrix, const RGBA &color)
-    : Model(matrix, color)
+Model2D::Model2D(const MeshTemplate &mesh, const AffineTransform &transform, const RGBA &color)
+    : Model(color)
 {
+    mesh_ = &mesh;
+    transform_ = transform;
     angle_ = 0;
-    ValidateMatrix(points_);
 }
 
 Model2D::Model2D(const Model2D &other)
     : Model(other)
 {
+    mesh_ = other.mesh_;
+    transform_ = other.transform_;
     angle_ = other.angle_;
-    color_ = other.color_;
-    points_ = other.points_;
 }
 
 Model2D::Model2D(const Model2D &&other)
     : Model(other)
 {
+    mesh_ = other.mesh_;
+    transform_ = other.transform_;
     angle_ = other.angle_;
-    color_ = other.color_;
-    points_ = other.points_;
 }
 #pragma endregion // Constructors and Destructors
 
+#pragma region Operators
+Model2D &Model2D::operator=(const Model2D &other)
+{
+    Model::operator=(other);
+    mesh_ = other.mesh_;
+    transform_ = other.transform_;
+    angle_ = other.angle_;
+    return *this;
+}
+
+Model2D &Model2D::operator=(const Model2D &&other)
+{
+    Model::operator=(other);
+    mesh_ = other.mesh_;
+    transform_ = other.transform_;
+    angle_ = other.angle_;
+    return *this;
+}
+#pragma endregion // Operators
+
 #pragma region Methods
 void Model2D::Translate(double dx, double dy)
 {
@@ -62,8 +90,7 @@ void Model2D::Translate(double dx, double dy)
 
 void Model2D::Translate(const Vector &vector)
 {
-    for (int i = 0; i < points_.get_rows(); i++)
-        points_[i] += vector;
+    transform_ = AffineTransform::Translation(vector[0], vector[1]) * transform_;
 }
 
 void Model2D::Scale(double x, double y, double sx, double sy)
@@ -113,17 +140,10 @@ void Model2D::Rotate(const Vector &center, double radians)
 
 void Model2D::Transform(const Matrix &matrix)
 {
-    for (int i = 0; i < points_.get_rows(); i++)
-    {
-        Vector point = Vector::Fill(3, 1);
-        point[0] = points_[i][0];
-        point[1] = points_[i][1];
+    ValidateMatrix(matrix);
 
-        point = matrix * point;
-
-        points_[i][0] = point[0];
-        points_[i][1] = point[1];
-    }
+    AffineTransform affine(matrix[0][0], matrix[1][0], matrix[0][1], matrix[1][1], matrix[0][2], matrix[1][2]);
+    transform_ = affine * transform_;
 }
 
 void Model2D::Transform(double x, double y, double sx, double sy, double radians)
@@ -152,54 +172,60 @@ void Model2D::Transform(const math::Vector &center, double sx, double sy, double
 
 void Model2D::Transform(const Vector &center, const Vector &scale, double radians)
 {
-    Matrix translate_matrix = Matrix::Identity(3, 3);
-    translate_matrix[0][2] = -center[0];
-    translate_matrix[1][2] = -center[1];
-
-    Matrix scale_matrix = Matrix::Identity(3, 3);
-    scale_matrix[0][0] = scale[0];
-    scale_matrix[1][1] = scale[1];
-
-    Matrix rotate_matrix = Matrix::Identity(3, 3);
-    rotate_matrix[0][0] = cos(radians);
-    rotate_matrix[0][1] = -sin(radians);
-    rotate_matrix[1][0] = sin(radians);
-    rotate_matrix[1][1] = cos(radians);
-
-    Matrix translate_back_matrix = Matrix::Identity(3, 3);
-    translate_back_matrix[0][2] = center[0];
-    translate_back_matrix[1][2] = center[1];
-
-    Transform(translate_back_matrix * scale_matrix * rotate_matrix * translate_matrix);
+    transform_ = AffineTransform::Translation(center[0], center[1]) *
+                 AffineTransform::Scale(scale[0], scale[1]) *
+                 AffineTransform::Rotation(radians) *
+                 AffineTransform::Translation(-center[0], -center[1]) *
+                 transform_;
 }
 
-void Model2D::Draw()
+void Model2D::Draw(BatchRenderer &renderer)
 {
-    double red = color_.get_red() / 255.0;
-    double green = color_.get_green() / 255.0;
-    double blue = color_.get_blue() / 255.0;
-    double alpha = color_.get_alpha() / 255.0;
-
-    glColor4d(red, green, blue, alpha);
-    glBegin(GL_POLYGON);
-    for (int i = 0; i < points_.get_rows(); i++)
-        glVertex2d(points_[i][0], points_[i][1]);
+    renderer.SubmitMesh(*mesh_, color_, transform_);
+}
 
-    glEnd();
+void Model2D::Draw(BatchRenderer &renderer, const AffineTransform &transform)
+{
+    renderer.SubmitMesh(*mesh_, color_, transform * transform_);
 }
 #pragma endregion // Methods
 
 #pragma region Private Methods
 void Model2D::ValidateMatrix(const math::Matrix &matrix)
 {
-    if (matrix.get_columns() != 2)
+    if (matrix.get_rows() < 2 || matrix.get_columns() != 3)
     {
-        throw std::invalid_argument("The matrix must have 2 columns.");
+        throw std::invalid_argument("The matrix must be a 3x3 homogeneous transform.");
     }
 }
 #pragma endregion // Private Methods
 
+#pragma region Getters
+Matrix Model2D::get_points() const
+{
+    int count = mesh_->get_vertex_count();
+    const double *xs = mesh_->get_xs();
+    const double *ys = mesh_->get_ys();
+
+    Matrix points = Matrix::Zero(count, 2);
+    for (int i = 0; i < count; i++)
+        transform_.Apply(xs[i], ys[i], points[i][0], points[i][1]);
+
+    return points;
+}
+
+const MeshTemplate &Model2D::get_mesh() const
+{
+    return *mesh_;
+}
+
+const AffineTransform &Model2D::get_transform() const
+{
+    return transform_;
+}
+
 double Model2D::get_angle() const
 {
     return angle_;
 }
+#pragma endregion // Getters
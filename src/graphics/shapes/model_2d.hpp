@@ -1,19 +1,25 @@
 #pragma once
 
 #include "./model.hpp"
+#include "./../rendering/mesh_template.hpp"
 
 namespace graphics::shapes
 {
+    // A shared unit mesh placed by an affine transform. Transformations compose into
+    // transform_ and the template itself is never touched.
     class Model2D : public Model
     {
     public:
         Model2D();
-        Model2D(const math::Matrix &matrix);
-        Model2D(const math::Matrix &matrix, const graphics::color::RGBA &color);
+        Model2D(const graphics::rendering::MeshTemplate &mesh, const math::AffineTransform &transform);
+        Model2D(const graphics::rendering::MeshTemplate &mesh, const math::AffineTransform &transform, const graphics::color::RGBA &color);
         Model2D(const Model2D &other);
         Model2D(const Model2D &&other);
         virtual ~Model2D() = default;
 
+        Model2D &operator=(const Model2D &other);
+        Model2D &operator=(const Model2D &&other);
+
         virtual void Translate(double dx, double dy);
         virtual void Translate(const math::Vector &vector);
         virtual void Scale(double x, double y, double sx, double sy);
@@ -26,15 +32,21 @@ namespace graphics::shapes
         virtual void Transform(const math::Vector &center, double sx, double sy, double radians);
         virtual void Transform(const math::Vector &center, const math::Vector &scale, double radians);
 
-        virtual void Draw();
+        virtual void Draw(graphics::rendering::BatchRenderer &renderer);
+        virtual void Draw(graphics::rendering::BatchRenderer &renderer, const math::AffineTransform &transform);
 
+        math::Matrix get_points() const override;
+        const graphics::rendering::MeshTemplate &get_mesh() const;
+        const math::AffineTransform &get_transform() const;
         virtual double get_angle() const;
         virtual math::Vector get_center_position() const = 0;
 
     protected:
+        const graphics::rendering::MeshTemplate *mesh_;
+        math::AffineTransform transform_;
         double angle_;
 
     private:
         void ValidateMatrix(const math::Matrix &matrix);
     };
-}
\ No newline at end of file
+}
@@ -27,6 +27,6 @@ namespace graphics::shapes
         double height_;
 
     private:
-        void BuildPoints(const math::Vector &origin, double width, double height);
+        static math::AffineTransform Place(const math::Vector &origin, double width, double height);
     };
 }
\ No newline at end of file
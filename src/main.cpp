@@ -9,12 +9,12 @@ using shoot_and_jump::Game;
 
 int main(int argc, char **argv)
 {
-    if (argc > 2)
+    if (argc > 4)
     {
         cout << "Too many arguments" << endl;
         return 1;
     }
-    else if (argc < 2)
+    else if (argc < 2 || argc == 3)
     {
         cout << "Too few arguments" << endl;
         return 1;
@@ -22,7 +22,12 @@ int main(int argc, char **argv)
     string configPath = argv[1];
 
     Game game(configPath);
-    game.Run(argc, argv);
+
+    // trabalhocg <config> <frames> <output prefix> renders without a window
+    if (argc == 4)
+        game.RunHeadless(stoi(argv[2]), argv[3]);
+    else
+        game.Run(argc, argv);
 
     return 0;
 }
\ No newline at end of file
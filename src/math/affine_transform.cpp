@@ -0,0 +1,83 @@
+#include "affine_transform.hpp"
+
+#include <cmath>
+
+using math::AffineTransform;
+using math::Vector;
+
+#pragma region Constructor and Destructor
+AffineTransform::AffineTransform()
+    : AffineTransform(1, 0, 0, 1, 0, 0)
+{
+}
+
+AffineTransform::AffineTransform(double a, double b, double c, double d, double tx, double ty)
+{
+    a_ = a;
+    b_ = b;
+    c_ = c;
+    d_ = d;
+    tx_ = tx;
+    ty_ = ty;
+}
+#pragma endregion // Constructor and Destructor
+
+#pragma region Operator Overloading
+AffineTransform AffineTransform::operator*(const AffineTransform &other) const
+{
+    return AffineTransform(
+        a_ * other.a_ + c_ * other.b_,
+        b_ * other.a_ + d_ * other.b_,
+        a_ * other.c_ + c_ * other.d_,
+        b_ * other.c_ + d_ * other.d_,
+        a_ * other.tx_ + c_ * other.ty_ + tx_,
+        b_ * other.tx_ + d_ * other.ty_ + ty_);
+}
+
+bool AffineTransform::operator==(const AffineTransform &other) const
+{
+    return a_ == other.a_ && b_ == other.b_ && c_ == other.c_ && d_ == other.d_ && tx_ == other.tx_ && ty_ == other.ty_;
+}
+
+bool AffineTransform::operator!=(const AffineTransform &other) const
+{
+    return !(*this == other);
+}
+#pragma endregion // Operator Overloading
+
+#pragma region Methods
+void AffineTransform::Apply(double x, double y, double &out_x, double &out_y) const
+{
+    out_x = a_ * x + c_ * y + tx_;
+    out_y = b_ * x + d_ * y + ty_;
+}
+
+Vector AffineTransform::Apply(const Vector &point) const
+{
+    Vector result(2);
+    Apply(point[0], point[1], result[0], result[1]);
+    return result;
+}
+
+AffineTransform AffineTransform::Identity()
+{
+    return AffineTransform();
+}
+
+AffineTransform AffineTransform::Translation(double dx, double dy)
+{
+    return AffineTransform(1, 0, 0, 1, dx, dy);
+}
+
+AffineTransform AffineTransform::Rotation(double radians)
+{
+    double cos = std::cos(radians);
+    double sin = std::sin(radians);
+    return AffineTransform(cos, sin, -sin, cos, 0, 0);
+}
+
+AffineTransform AffineTransform::Scale(double sx, double sy)
+{
+    return AffineTransform(sx, 0, 0, sy, 0, 0);
+}
+#pragma endregion // Methods
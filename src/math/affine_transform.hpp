@@ -0,0 +1,34 @@
+#pragma once
+
+#include "vector.hpp"
+
+namespace math
+{
+    // 2D affine transform mapping (x, y) to (a x + c y + tx, b x + d y + ty).
+    class AffineTransform
+    {
+    public:
+        AffineTransform();
+        AffineTransform(double a, double b, double c, double d, double tx, double ty);
+
+        AffineTransform operator*(const AffineTransform &other) const;
+        bool operator==(const AffineTransform &other) const;
+        bool operator!=(const AffineTransform &other) const;
+
+        void Apply(double x, double y, double &out_x, double &out_y) const;
+        Vector Apply(const Vector &point) const;
+
+        static AffineTransform Identity();
+        static AffineTransform Translation(double dx, double dy);
+        static AffineTransform Rotation(double radians);
+        static AffineTransform Scale(double sx, double sy);
+
+    private:
+        double a_;
+        double b_;
+        double c_;
+        double d_;
+        double tx_;
+        double ty_;
+    };
+} // namespace math
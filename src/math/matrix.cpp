@@ -239,7 +239,7 @@ Matrix &Matrix::operator^=(const int &other)
     return *this;
 }
 
-Vector Matrix::operator[](int i) const
+const Vector &Matrix::operator[](int i) const
 {
     if (i < 0 || i >= this->rows_)
         throw std::invalid_argument("Index out of bounds");
@@ -30,7 +30,7 @@ namespace math
         Matrix &operator/=(const double &other);
         Matrix &operator^=(const int &other);
 
-        Vector operator[](int i) const;
+        const Vector &operator[](int i) const;
         Vector &operator[](int i);
 
         int get_rows() const;
@@ -3,35 +3,131 @@
 #include <algorithm>
 #include <vector>
 
+#include "contact.hpp"
 #include "icollidable.hpp"
+#include "../math/vector.hpp"
 
 using ::physic::CollisionSystem;
+using ::physic::Contact;
 using ::physic::ICollidable;
 using ::std::tuple;
 using ::std::vector;
 
 void CollisionSystem::AddToCollisionSystem(ICollidable *collidable)
 {
+    m_indices_[collidable] = m_collidables_.size();
     m_collidables_.push_back(collidable);
 }
 
 void CollisionSystem::RemoveFromCollisionSystem(ICollidable *collidable)
 {
-    m_collidables_.erase(std::remove(m_collidables_.begin(), m_collidables_.end(), collidable), m_collidables_.end());
+    m_inactive_collidables_.erase(collidable);
+
+    auto it = m_indices_.find(collidable);
+    if (it == m_indices_.end())
+        return;
+
+    size_t index = it->second;
+    m_indices_.erase(it);
+
+    if (index != m_collidables_.size() - 1)
+    {
+        m_collidables_[index] = m_collidables_.back();
+        m_indices_[m_collidables_[index]] = index;
+    }
+    m_collidables_.pop_back();
+}
+
+void CollisionSystem::set_active(ICollidable *collidable, bool active)
+{
+    if (active)
+        m_inactive_collidables_.erase(collidable);
+    else
+        m_inactive_collidables_.insert(collidable);
 }
 
 #include <iostream>
 using namespace std;
 void CollisionSystem::ProcessCollisions()
 {
+    m_active_collidables_.clear();
     for (auto &collidable : m_collidables_)
-        for (auto &other_collidable : m_collidables_)
+        if (m_inactive_collidables_.count(collidable) == 0)
+            m_active_collidables_.push_back(collidable);
+
+    size_t active_count = m_active_collidables_.size();
+    m_pair_test_count_ = active_count > 0 ? active_count * (active_count - 1) : 0;
+    m_contacts_.clear();
+
+    for (auto &collidable : m_active_collidables_)
+        for (auto &other_collidable : m_active_collidables_)
             if (collidable != other_collidable)
                 if (collidable->IsColliding(other_collidable))
+                {
+                    if (m_record_contacts_)
+                        m_contacts_.push_back(ComputeContact(collidable, other_collidable));
                     collidable->ProcessCollision(other_collidable);
+                }
     // if (collidable->get_position()[0] < other_collidable->get_position()[0] + other_collidable->get_width() &&
     //     collidable->get_position()[0] + collidable->get_width() > other_collidable->get_position()[0] &&
     //     collidable->get_position()[1] < other_collidable->get_position()[1] + other_collidable->get_height() &&
     //     collidable->get_position()[1] + collidable->get_height() > other_collidable->get_position()[1])
     //     collidable->ProcessCollision(other_collidable);
-}
\ No newline at end of file
+}
+
+void CollisionSystem::set_record_contacts(bool record_contacts)
+{
+    m_record_contacts_ = record_contacts;
+    if (!record_contacts)
+        m_contacts_.clear();
+}
+
+int CollisionSystem::get_size() const
+{
+    return m_collidables_.size();
+}
+
+int CollisionSystem::get_pair_test_count() const
+{
+    return m_pair_test_count_;
+}
+
+const vector<ICollidable *> &CollisionSystem::get_collidables() const
+{
+    return m_collidables_;
+}
+
+const vector<Contact> &CollisionSystem::get_contacts() const
+{
+    return m_contacts_;
+}
+
+Contact CollisionSystem::ComputeContact(ICollidable *collidable, ICollidable *other_collidable)
+{
+    math::Vector position = collidable->get_position();
+    math::Vector other_position = other_collidable->get_position();
+
+    double left = std::max(position[0], other_position[0]);
+    double right = std::min(position[0] + collidable->get_width(), other_position[0] + other_collidable->get_width());
+    double top = std::max(position[1], other_position[1]);
+    double bottom = std::min(position[1] + collidable->get_height(), other_position[1] + other_collidable->get_height());
+
+    double center_x = position[0] + collidable->get_width() / 2;
+    double center_y = position[1] + collidable->get_height() / 2;
+    double other_center_x = other_position[0] + other_collidable->get_width() / 2;
+    double other_center_y = other_position[1] + other_collidable->get_height() / 2;
+
+    Contact contact = {(left + right) / 2, (top + bottom) / 2, 0, 0, 0};
+    if (right - left < bottom - top)
+    {
+        contact.normal_x = center_x < other_center_x ? -1 : 1;
+        contact.depth = right - left;
+    }
+    else
+    {
+        contact.normal_y = center_y < other_center_y ? -1 : 1;
+        contact.depth = bottom - top;
+    }
+
+    return contact;
+}
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "icollidable.hpp"
+#include "contact.hpp"
 
 #include <vector>
+#include <unordered_set>
+#include <unordered_map>
 
 namespace physic
 {
@@ -13,7 +16,27 @@ namespace physic
         void RemoveFromCollisionSystem(ICollidable *collidable);
         void ProcessCollisions();
 
+        void set_active(ICollidable *collidable, bool active);
+
+        // Contacts are only computed while recording, for the debug overlay.
+        void set_record_contacts(bool record_contacts);
+
+        int get_size() const;
+        // Overlap tests run by the last ProcessCollisions.
+        int get_pair_test_count() const;
+        const std::vector<ICollidable *> &get_collidables() const;
+        // Contacts found by the last ProcessCollisions, one per ordered pair.
+        const std::vector<Contact> &get_contacts() const;
+
     private:
         std::vector<ICollidable *> m_collidables_;
+        std::unordered_map<ICollidable *, size_t> m_indices_;
+        std::vector<ICollidable *> m_active_collidables_;
+        std::unordered_set<ICollidable *> m_inactive_collidables_;
+        int m_pair_test_count_ = 0;
+        bool m_record_contacts_ = false;
+        std::vector<Contact> m_contacts_;
+
+        static Contact ComputeContact(ICollidable *collidable, ICollidable *other_collidable);
     };
 }
\ No newline at end of file
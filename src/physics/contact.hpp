@@ -0,0 +1,15 @@
+#pragma once
+
+namespace physic
+{
+    // Where two boxes overlap, with the normal pushing the first one out of the second
+    // along the axis of least penetration.
+    struct Contact
+    {
+        double x;
+        double y;
+        double normal_x;
+        double normal_y;
+        double depth;
+    };
+}
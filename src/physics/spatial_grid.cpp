@@ -0,0 +1,177 @@
+#include "spatial_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "icollidable.hpp"
+#include "../math/vector.hpp"
+
+using ::math::Vector;
+using ::physic::ICollidable;
+using ::physic::SpatialGrid;
+using ::std::vector;
+
+#pragma region Constructors and Destructors
+SpatialGrid::SpatialGrid(double cell_size)
+{
+    cell_size_ = cell_size;
+}
+#pragma endregion // Constructors and Destructors
+
+#pragma region Public Methods
+void SpatialGrid::Insert(ICollidable *collidable)
+{
+    if (ranges_.count(collidable))
+        return;
+
+    CellRange range = ComputeRange(collidable);
+    ranges_[collidable] = range;
+    query_stamps_[collidable] = 0;
+    InsertIntoCells(collidable, range);
+}
+
+void SpatialGrid::Remove(ICollidable *collidable)
+{
+    auto it = ranges_.find(collidable);
+    if (it == ranges_.end())
+        return;
+
+    RemoveFromCells(collidable, it->second);
+    ranges_.erase(it);
+    query_stamps_.erase(collidable);
+}
+
+void SpatialGrid::Update(ICollidable *collidable)
+{
+    auto it = ranges_.find(collidable);
+    if (it == ranges_.end())
+        return;
+
+    CellRange range = ComputeRange(collidable);
+    if (range == it->second)
+        return;
+
+    RemoveFromCells(collidable, it->second);
+    InsertIntoCells(collidable, range);
+    it->second = range;
+}
+
+void SpatialGrid::Clear()
+{
+    cells_.clear();
+    ranges_.clear();
+    query_stamps_.clear();
+}
+
+void SpatialGrid::Query(double x, double y, double width, double height, vector<ICollidable *> &result)
+{
+    CellRange range = ComputeRange(x, y, width, height);
+    query_stamp_++;
+
+    for (int cell_x = range.min_x; cell_x <= range.max_x; cell_x++)
+    {
+        for (int cell_y = range.min_y; cell_y <= range.max_y; cell_y++)
+        {
+            auto cell = cells_.find(Key(cell_x, cell_y));
+            if (cell == cells_.end())
+                continue;
+
+            for (auto &collidable : cell->second)
+            {
+                unsigned int &stamp = query_stamps_[collidable];
+                if (stamp == query_stamp_)
+                    continue;
+
+                stamp = query_stamp_;
+                result.push_back(collidable);
+            }
+        }
+    }
+}
+
+void SpatialGrid::QueryCells(double x, double y, double width, double height, vector<CellOccupancy> &result) const
+{
+    CellRange range = ComputeRange(x, y, width, height);
+
+    for (int cell_x = range.min_x; cell_x <= range.max_x; cell_x++)
+    {
+        for (int cell_y = range.min_y; cell_y <= range.max_y; cell_y++)
+        {
+            auto cell = cells_.find(Key(cell_x, cell_y));
+            if (cell != cells_.end())
+                result.push_back({cell_x, cell_y, static_cast<int>(cell->second.size())});
+        }
+    }
+}
+
+double SpatialGrid::get_cell_size() const
+{
+    return cell_size_;
+}
+
+int SpatialGrid::get_size() const
+{
+    return ranges_.size();
+}
+#pragma endregion // Public Methods
+
+#pragma region Private Methods
+bool SpatialGrid::CellRange::operator==(const CellRange &other) const
+{
+    return min_x == other.min_x && min_y == other.min_y && max_x == other.max_x && max_y == other.max_y;
+}
+
+SpatialGrid::CellRange SpatialGrid::ComputeRange(double x, double y, double width, double height) const
+{
+    CellRange range;
+    range.min_x = static_cast<int>(std::floor(x / cell_size_));
+    range.min_y = static_cast<int>(std::floor(y / cell_size_));
+    range.max_x = static_cast<int>(std::floor((x + width) / cell_size_));
+    range.max_y = static_cast<int>(std::floor((y + height) / cell_size_));
+    return range;
+}
+
+SpatialGrid::CellRange SpatialGrid::ComputeRange(ICollidable *collidable) const
+{
+    Vector position = collidable->get_position();
+    return ComputeRange(position[0], position[1], collidable->get_width(), collidable->get_height());
+}
+
+void SpatialGrid::InsertIntoCells(ICollidable *collidable, const CellRange &range)
+{
+    for (int cell_x = range.min_x; cell_x <= range.max_x; cell_x++)
+        for (int cell_y = range.min_y; cell_y <= range.max_y; cell_y++)
+            cells_[Key(cell_x, cell_y)].push_back(collidable);
+}
+
+void SpatialGrid::RemoveFromCells(ICollidable *collidable, const CellRange &range)
+{
+    for (int cell_x = range.min_x; cell_x <= range.max_x; cell_x++)
+    {
+        for (int cell_y = range.min_y; cell_y <= range.max_y; cell_y++)
+        {
+            auto cell = cells_.find(Key(cell_x, cell_y));
+            if (cell == cells_.end())
+                continue;
+
+            vector<ICollidable *> &collidables = cell->second;
+            auto it = std::find(collidables.begin(), collidables.end(), collidable);
+            if (it != collidables.end())
+            {
+                *it = collidables.back();
+                collidables.pop_back();
+            }
+
+            if (collidables.empty())
+                cells_.erase(cell);
+        }
+    }
+}
+
+long long SpatialGrid::Key(int cell_x, int cell_y)
+{
+    // Shifted as unsigned: left-shifting a negative cell index is undefined.
+    unsigned long long key = (static_cast<unsigned long long>(static_cast<unsigned int>(cell_x)) << 32) | static_cast<unsigned int>(cell_y);
+    return static_cast<long long>(key);
+}
+#pragma endregion // Private Methods
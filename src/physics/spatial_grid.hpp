@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "icollidable.hpp"
+
+namespace physic
+{
+    // Uniform grid bucketing collidables by the cells their bounding box overlaps.
+    class SpatialGrid
+    {
+    public:
+        struct CellOccupancy
+        {
+            int cell_x;
+            int cell_y;
+            int count;
+        };
+
+        SpatialGrid(double cell_size = default_cell_size_);
+
+        void Insert(ICollidable *collidable);
+        void Remove(ICollidable *collidable);
+        // Re-buckets the collidable only when its box crossed into other cells.
+        void Update(ICollidable *collidable);
+        void Clear();
+
+        // Appends every collidable sharing a cell with the box; a collidable spanning
+        // several of those cells is reported once.
+        void Query(double x, double y, double width, double height, std::vector<ICollidable *> &result);
+        // Appends every occupied cell overlapping the box, for debug drawing.
+        void QueryCells(double x, double y, double width, double height, std::vector<CellOccupancy> &result) const;
+
+        double get_cell_size() const;
+        int get_size() const;
+
+        inline static double default_cell_size_ = 16;
+
+    private:
+        struct CellRange
+        {
+            int min_x;
+            int min_y;
+            int max_x;
+            int max_y;
+
+            bool operator==(const CellRange &other) const;
+        };
+
+        double cell_size_;
+        std::unordered_map<long long, std::vector<ICollidable *>> cells_;
+        std::unordered_map<ICollidable *, CellRange> ranges_;
+        std::unordered_map<ICollidable *, unsigned int> query_stamps_;
+        unsigned int query_stamp_ = 0;
+
+        CellRange ComputeRange(double x, double y, double width, double height) const;
+        CellRange ComputeRange(ICollidable *collidable) const;
+        void InsertIntoCells(ICollidable *collidable, const CellRange &range);
+        void RemoveFromCells(ICollidable *collidable, const CellRange &range);
+
+        static long long Key(int cell_x, int cell_y);
+    };
+}